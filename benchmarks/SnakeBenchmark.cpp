@@ -0,0 +1,417 @@
+#include <benchmark/benchmark.h>
+#include "Simulation.hpp"
+#include "GameMap.hpp"
+#include "Snake.hpp"
+#include "ItemManager.hpp"
+#include "GateManager.hpp"
+#include "StageManager.hpp"
+#include "MapRenderer.hpp"
+#include "ColorManager.hpp"
+#include "AutopilotPolicy.hpp"
+#include "DistanceFieldCache.hpp"
+#include <ncurses.h>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+// 벤치마크 공통 인자
+// - 맵 크기: 21(기본), 41, 81, 161
+// - 벽 밀도: 내부 빈 칸 중 Wall(1)로 채우는 비율 (%)
+// - 뱀 길이
+
+namespace {
+
+const uint32_t BENCH_SEED = 12345;  // 실행마다 같은 맵을 쓰도록 고정 시드
+
+// 내부 빈 칸을 densityPercent% 확률로 Wall(1)로 채움 (뱀 점유 칸 제외)
+void placeInnerWalls(GameMap& map, int densityPercent, const Snake* snake) {
+    std::mt19937 rng(BENCH_SEED);
+    std::uniform_int_distribution<int> percent(0, 99);
+    for (int y = 1; y < map.getHeight() - 1; y++) {
+        for (int x = 1; x < map.getWidth() - 1; x++) {
+            if (map.getCellUnchecked(x, y) != 0) continue;
+            if (snake != nullptr && snake->isOccupied(x, y)) continue;
+            if (percent(rng) < densityPercent) {
+                map.setCellUnchecked(x, y, 1);
+            }
+        }
+    }
+    map.markAllDirty();
+}
+
+// 한 변이 side인 사각형을 따라 도는 방향 (side칸마다 시계 방향으로 회전)
+Direction squareLoopDirection(long long step, int side) {
+    static const Direction order[] = {Direction::RIGHT, Direction::DOWN, Direction::LEFT, Direction::UP};
+    return order[(step / side) % 4];
+}
+
+// 사각형 경로를 따라 이동시켜 원하는 길이의 뱀 생성
+void growAlongSquare(Snake& snake, int length, int side, long long& step) {
+    while (snake.getLength() < length) {
+        snake.setDirection(squareLoopDirection(step, side));
+        snake.grow();
+        snake.move();
+        step++;
+    }
+    snake.clearChangedCells();
+}
+
+// 방향키 행동으로 사각형 경로를 따라 돌게 함 (벽에 바로 부딪히지 않도록)
+GameAction squareLoopAction(long long tick, int side) {
+    static const GameAction turns[] = {
+        GameAction::TURN_RIGHT, GameAction::TURN_DOWN, GameAction::TURN_LEFT, GameAction::TURN_UP
+    };
+    return turns[(tick / side) % 4];
+}
+
+// 출력을 버리는 ncurses 화면 (벤치마크 동안 유지)
+class NullTerminal {
+public:
+    NullTerminal() : output(std::fopen("/dev/null", "w")), input(std::fopen("/dev/null", "r")), screen(nullptr) {
+        const char* term = std::getenv("TERM");
+        if (output != nullptr && input != nullptr) {
+            screen = newterm(term != nullptr ? term : "xterm", output, input);
+        }
+        if (screen != nullptr) {
+            set_term(screen);
+            resizeterm(200, 200);
+        }
+    }
+    ~NullTerminal() {
+        if (screen != nullptr) {
+            endwin();
+            delscreen(screen);
+        }
+        if (output != nullptr) std::fclose(output);
+        if (input != nullptr) std::fclose(input);
+    }
+    bool isReady() const { return screen != nullptr; }
+
+private:
+    FILE* output;
+    FILE* input;
+    SCREEN* screen;
+};
+
+}  // namespace
+
+// Snake::move + checkSelfCollision (인자: 뱀 길이)
+static void BM_SnakeMove(benchmark::State& state) {
+    int length = static_cast<int>(state.range(0));
+    int side = length / 4 + 2;  // 둘레가 길이보다 길어 자기 충돌이 없는 경로
+    Snake snake(side + 2, side + 2);
+    long long step = 0;
+    growAlongSquare(snake, length, side, step);
+
+    for (auto _ : state) {
+        snake.setDirection(squareLoopDirection(step, side));
+        snake.move();
+        benchmark::DoNotOptimize(snake.checkSelfCollision());
+        snake.clearChangedCells();
+        step++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SnakeMove)->RangeMultiplier(4)->Range(4, 4096);
+
+// 헤드리스 게임 한 틱 (인자: 맵 크기)
+static void BM_SimulationUpdate(benchmark::State& state) {
+    int size = static_cast<int>(state.range(0));
+    int side = size / 4;
+    auto simulation = std::make_unique<Simulation>(size, size);
+    long long tick = 0;
+
+    for (auto _ : state) {
+        if (simulation->isGameOver()) {
+            // 게임 오버 시 새 게임으로 교체 (측정에서 제외)
+            state.PauseTiming();
+            simulation = std::make_unique<Simulation>(size, size);
+            tick = 0;
+            state.ResumeTiming();
+        }
+        simulation->applyAction(squareLoopAction(tick, side));
+        simulation->update();
+        tick++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SimulationUpdate)->Arg(21)->Arg(41)->Arg(81)->Arg(161)->Arg(1025)->Arg(4097);
+
+// 맵 그리기 - 출력은 /dev/null (인자: 맵 크기, 전체 다시 그리기 여부)
+static void BM_MapRendererDraw(benchmark::State& state) {
+    NullTerminal terminal;
+    if (!terminal.isReady()) {
+        state.SkipWithError("terminal initialization failed");
+        return;
+    }
+
+    int size = static_cast<int>(state.range(0));
+    bool fullRedraw = state.range(1) != 0;
+    GameMap map(size, size);
+    placeInnerWalls(map, 10, nullptr);
+
+    auto colorManager = std::make_shared<ColorManager>();
+    colorManager->initializeColors();
+    MapRenderer renderer;
+    renderer.setColorManager(colorManager);
+    renderer.draw(map);
+
+    int cell = 0;
+    int interior = (size - 2) * (size - 2);
+    for (auto _ : state) {
+        if (fullRedraw) {
+            renderer.invalidate();
+        } else {
+            // 틱마다 바뀌는 정도의 변화 (머리 한 칸 이동)
+            int x = 1 + cell % (size - 2);
+            int y = 1 + cell / (size - 2);
+            map.setCellUnchecked(x, y, map.getCellUnchecked(x, y) == 3 ? 0 : 3);
+            cell = (cell + 1) % interior;
+        }
+        renderer.draw(map);
+        refresh();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MapRendererDraw)->ArgsProduct({{21, 81}, {0, 1}});
+
+// 큰 맵의 뷰포트 그리기 - 80x40 화면이 움직이는 머리를 따라감 (인자: 맵 크기)
+static void BM_MapRendererViewportDraw(benchmark::State& state) {
+    NullTerminal terminal;
+    if (!terminal.isReady()) {
+        state.SkipWithError("terminal initialization failed");
+        return;
+    }
+
+    int size = static_cast<int>(state.range(0));
+    GameMap map(size, size);
+    auto colorManager = std::make_shared<ColorManager>();
+    colorManager->initializeColors();
+    MapRenderer renderer;
+    renderer.setColorManager(colorManager);
+    renderer.getViewport().setScreenSize(80, 40);
+
+    // 머리가 가운데 행을 따라 한 칸씩 이동 (가장자리 여백에 닿을 때만 카메라가 움직임)
+    int y = size / 2;
+    int x = 1;
+    for (auto _ : state) {
+        map.setCellUnchecked(x, y, 0);
+        x = x + 1 < size - 1 ? x + 1 : 1;
+        map.setCellUnchecked(x, y, 3);
+        renderer.draw(map, x, y);
+        refresh();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MapRendererViewportDraw)->Arg(81)->Arg(1025)->Arg(4097);
+
+// Gate 쌍 생성 (인자: 맵 크기, 내부 벽 밀도 %)
+static void BM_GenerateGates(benchmark::State& state) {
+    int size = static_cast<int>(state.range(0));
+    GameClock clock;
+    GameMap map(size, size);
+    Snake snake(size / 2, size / 2);
+    placeInnerWalls(map, static_cast<int>(state.range(1)), &snake);
+    GateManager gateManager(map, clock);
+
+    for (auto _ : state) {
+        gateManager.restoreGatePositionsToWalls();
+        gateManager.generateGates(snake);
+        benchmark::DoNotOptimize(gateManager.getGateCount());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GenerateGates)->ArgsProduct({{21, 81, 161}, {0, 10, 50}});
+
+// 빈 칸 찾기 (인자: 맵 크기, 벽 밀도 %)
+static void BM_FindEmptyPosition(benchmark::State& state) {
+    int size = static_cast<int>(state.range(0));
+    GameClock clock;
+    GameMap map(size, size);
+    Snake snake(size / 2, size / 2);
+    placeInnerWalls(map, static_cast<int>(state.range(1)), &snake);
+    ItemManager itemManager(map, clock);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(itemManager.findEmptyPosition(snake));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FindEmptyPosition)->ArgsProduct({{21, 81, 161}, {0, 50, 90, 99}});
+
+// 아이템 맵 반영 - 전체 맵 스캔 (인자: 맵 크기)
+static void BM_ItemManagerUpdateMap(benchmark::State& state) {
+    int size = static_cast<int>(state.range(0));
+    GameClock clock;
+    GameMap map(size, size);
+    Snake snake(size / 2, size / 2);
+    ItemManager itemManager(map, clock);
+    for (int i = 0; i < 3; i++) {
+        itemManager.generateItems(snake);
+    }
+
+    for (auto _ : state) {
+        itemManager.updateMap();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ItemManagerUpdateMap)->Arg(21)->Arg(81)->Arg(161);
+
+// 게임 맵 갱신 - 한 틱 분량의 증분 갱신 vs 전체 재구성 (인자: 맵 크기, 전체 재구성 여부)
+static void BM_SimulationUpdateMap(benchmark::State& state) {
+    int size = static_cast<int>(state.range(0));
+    bool rebuild = state.range(1) != 0;
+    Simulation simulation(size, size);
+    simulation.updateMap();
+    GameMap& map = simulation.getMap();
+    const Snake& snake = simulation.getSnake();
+
+    for (auto _ : state) {
+        if (rebuild) {
+            map.markAllDirty();
+        } else {
+            // 머리/꼬리 이동 정도의 변경
+            map.markDirty(snake.getHeadX(), snake.getHeadY());
+            map.markDirty(snake.getHeadX() - 1, snake.getHeadY());
+        }
+        simulation.updateMap();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SimulationUpdateMap)->ArgsProduct({{21, 81, 161}, {0, 1}});
+
+// 무작위 Temporary Wall 생성 (인자: 맵 크기, 벽 밀도 %)
+static void BM_CreateRandomTemporaryWalls(benchmark::State& state) {
+    int size = static_cast<int>(state.range(0));
+    Simulation simulation(size, size);
+    placeInnerWalls(simulation.getMap(), static_cast<int>(state.range(1)), &simulation.getSnake());
+    simulation.updateMap();
+
+    for (auto _ : state) {
+        simulation.createRandomTemporaryWalls();
+        state.PauseTiming();
+        simulation.getTemporaryWallManager().clear();
+        simulation.updateMap();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CreateRandomTemporaryWalls)->ArgsProduct({{21, 81, 161}, {0, 50}});
+
+// 스테이지 맵 적용 (인자: 스테이지 번호)
+static void BM_ApplyCurrentStageToMap(benchmark::State& state) {
+    StageManager stageManager;
+    for (int stage = 1; stage < state.range(0); stage++) {
+        stageManager.nextStage();
+    }
+    GameMap map(21, 21);
+
+    for (auto _ : state) {
+        stageManager.applyCurrentStageToMap(map);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ApplyCurrentStageToMap)->DenseRange(1, 4);
+
+// 스냅샷 저장 + 한 틱 진행 + 되감기 (탐색 봇의 포크/롤백 한 번, 인자: 맵 크기)
+static void BM_SnapshotRoundTrip(benchmark::State& state) {
+    int size = static_cast<int>(state.range(0));
+    int side = size / 4;
+    Simulation simulation(size, size, BENCH_SEED);
+    long long tick = 0;
+    for (; tick < 20 && !simulation.isGameOver(); tick++) {
+        simulation.applyAction(squareLoopAction(tick, side));
+        simulation.update();
+    }
+    std::vector<uint8_t> snapshot;
+
+    for (auto _ : state) {
+        simulation.saveSnapshot(snapshot);
+        simulation.applyAction(squareLoopAction(tick, side));
+        simulation.update();
+        benchmark::DoNotOptimize(simulation.restoreSnapshot(snapshot));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bytes"] = static_cast<double>(snapshot.size());
+}
+BENCHMARK(BM_SnapshotRoundTrip)->Arg(21)->Arg(31)->Arg(81)->Arg(161);
+
+// 포크 + 자식 한 틱 진행 + 자식 폐기 (트리 탐색의 노드 확장 한 번, 인자: 맵 크기)
+static void BM_SimulationFork(benchmark::State& state) {
+    int size = static_cast<int>(state.range(0));
+    int side = size / 4;
+    Simulation simulation(size, size, BENCH_SEED);
+    long long tick = 0;
+    for (; tick < 20 && !simulation.isGameOver(); tick++) {
+        simulation.applyAction(squareLoopAction(tick, side));
+        simulation.update();
+    }
+
+    for (auto _ : state) {
+        auto child = simulation.fork();
+        child->applyAction(squareLoopAction(tick, side));
+        child->update();
+        benchmark::DoNotOptimize(child->isGameOver());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SimulationFork)->Arg(21)->Arg(81)->Arg(161)->Arg(641);
+
+// 오토파일럿 한 번의 결정 (A* + 생존 판정, 인자: 맵 크기, 1이면 목표를 벽으로 막아 닿을 수 없게 함)
+// 부하 생성기로 쓰므로 큰 맵에서도 틱 예산보다 훨씬 짧아야 함 (닿을 수 없으면 확장 예산에서 멈춤)
+static void BM_AutopilotDecision(benchmark::State& state) {
+    int size = static_cast<int>(state.range(0));
+    bool unreachable = state.range(1) != 0;
+    Simulation simulation(size, size, BENCH_SEED);
+    AutopilotPolicy policy;
+    simulation.getItemManager().addItem(size - 3, 2, ItemType::GROWTH);  // 머리에서 먼 구석
+    simulation.getItemManager().updateMap();
+    if (unreachable) {
+        simulation.getMap().setCellValue(size - 4, 2, 1);
+        simulation.getMap().setCellValue(size - 2, 2, 1);
+        simulation.getMap().setCellValue(size - 3, 1, 1);
+        simulation.getMap().setCellValue(size - 3, 3, 1);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(policy.chooseAction(simulation));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["expanded"] = policy.getLastExpandedCount();
+    state.counters["path"] = policy.getLastPathLength();
+}
+BENCHMARK(BM_AutopilotDecision)->ArgsProduct({{21, 81, 161, 641}, {0, 1}})->Args({1025, 1})->Args({4097, 1});
+
+// 한 틱 진행 후 거리장 동기화 (인자: 맵 크기, 0 증분 보정 / 1 매번 전체 계산)
+static void BM_DistanceFieldSync(benchmark::State& state) {
+    int size = static_cast<int>(state.range(0));
+    bool rebuild = state.range(1) != 0;
+    int side = size / 4;
+    Simulation simulation(size, size, BENCH_SEED);
+    simulation.getGateManager().generateGates(simulation.getSnake());
+    DistanceFieldCache cache(simulation);
+    long long tick = 0;
+    long long fields = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        simulation.applyAction(squareLoopAction(tick++, side));
+        simulation.update();
+        state.ResumeTiming();
+        if (rebuild) {
+            cache.rebuildAll();
+        } else {
+            cache.sync();
+        }
+        fields += cache.getFieldCount();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["fields"] = benchmark::Counter(static_cast<double>(fields), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_DistanceFieldSync)->ArgsProduct({{81, 161, 641}, {0, 1}});
+
+BENCHMARK_MAIN();
@@ -0,0 +1,93 @@
+#ifndef AUTOPILOT_POLICY_HPP
+#define AUTOPILOT_POLICY_HPP
+
+#include "InputPolicy.hpp"
+#include "NavigationGraph.hpp"
+#include <cstdint>
+#include <vector>
+
+// 가장 가까운 Growth 아이템까지 A* 최단 경로를 따라가는 자동 조종 (Game 오토파일럿, 부하 생성용 봇)
+// - 벽, 뱀 몸, Temporary Wall, Poison 칸은 지나갈 수 없는 칸으로 취급
+// - Gate는 NavigationGraph의 순간이동 간선으로 통과 (Gate 너머가 더 가까우면 Gate로 들어감)
+// - 경로가 없거나, A*가 확장 예산을 다 쓰거나, 첫 칸이 뱀 길이보다 좁은 공간으로 이어지면
+//   최장 생존 휴리스틱으로 전환
+//   (다음 칸에서 도달 가능한 빈 칸이 가장 많은 방향, 같으면 직진 유지)
+// - 방문 표시/첫 이동 방향/거리는 탐색 예산 크기의 칸 표에 두고 세대 번호로 유효성을 구분해
+//   탐색마다 지우지 않고 재사용 (큰 맵에서도 맵 크기의 버퍼를 만들지 않음)
+class AutopilotPolicy : public InputPolicy {
+public:
+    explicit AutopilotPolicy(int floodFillLimit = DEFAULT_FLOOD_FILL_LIMIT,
+                             int expansionLimit = DEFAULT_EXPANSION_LIMIT);
+
+    GameAction chooseAction(const Simulation& simulation) override;
+
+    // 마지막 chooseAction의 탐색 결과 (테스트/벤치마크용)
+    int getLastPathLength() const { return lastPathLength; }  // Growth까지 칸 수 (경로 없으면 -1)
+    int getLastExpandedCount() const { return lastExpandedCount; }  // A*가 확장한 칸 수
+
+    // 경로 탐색에서 지나갈 수 있는 맵 값 (빈 칸, Growth, Speed)
+    static bool isPassableCell(int cellValue) { return NavigationGraph::isPassableCell(cellValue); }
+
+    // 생존 휴리스틱에서 방향마다 세는 빈 칸 수 상한 (큰 맵에서 탐색 비용 제한)
+    static const int DEFAULT_FLOOD_FILL_LIMIT;
+    // A*가 한 번에 확장하는 칸 수 상한 (닿을 수 없는 목표가 큰 맵 전체를 훑지 않도록, 0 이하면 제한 없음)
+    static const int DEFAULT_EXPANSION_LIMIT;
+
+private:
+    // 프런티어 원소 (f = 거리 + 추정 거리, slot = 칸 표에서의 위치)
+    struct Node {
+        int f;
+        int g;
+        int index;
+        int slot;
+    };
+
+    int floodFillLimit;
+    int expansionLimit;
+    int width;
+    int height;
+
+    // 탐색한 칸 표: 칸 번호를 키로 하는 열린 주소법 해시 (선형 탐사, 삭제 없음)
+    // 크기는 한 번의 탐색이 넣을 수 있는 칸 수(확장 예산, flood fill 상한)의 두 배라 맵 크기와 무관
+    // 세대 번호가 현재 generation과 같은 슬롯만 사용 중 (탐색마다 지우지 않음)
+    std::vector<uint32_t> slotStamp;
+    std::vector<int> slotCell;
+    std::vector<int> slotDistance;
+    std::vector<uint8_t> slotFirstMove;  // 머리에서 이 칸으로 가는 경로의 첫 이동 방향
+    int slotShift;
+    uint32_t generation;
+    std::vector<Node> frontier;     // A* 힙 (최소 f)
+    std::vector<int> queue;         // flood fill용 BFS 큐
+
+    std::vector<int> targetX;  // Growth 아이템 좌표 (추정 거리 계산용)
+    std::vector<int> targetY;
+    // 순간이동 간선의 진입 칸 좌표와 (1 + 출구에서 가장 가까운 목표까지 추정 거리)
+    std::vector<int> teleportX;
+    std::vector<int> teleportY;
+    std::vector<int> teleportCost;
+
+    int lastPathLength;
+    int lastExpandedCount;
+
+    // 칸 표 크기를 맞추고 새 세대 시작
+    void beginSearch(const GameMap& map);
+
+    // cell이 들어 있는 슬롯, 없으면 cell이 들어갈 빈 슬롯 (slotStamp로 구분)
+    int findSlot(int cell) const;
+
+    // 머리에서 Growth까지 A* 탐색, 찾으면 첫 이동 방향 인덱스 (없거나 확장 예산을 넘기면 -1)
+    // firstCell에는 첫 이동으로 도착하는 칸 (Gate면 순간이동 출구)
+    int findPathToGrowth(const Simulation& simulation, int& firstCell);
+
+    // start 칸에서 지나갈 수 있는 칸 수 (limit에서 중단, start 자체가 막혀 있으면 0)
+    int countReachable(const GameMap& map, int start, int limit);
+
+    // 생존 휴리스틱으로 이동 방향 인덱스 선택 (갈 곳이 없으면 -1)
+    int chooseSurvivalDirection(const Simulation& simulation);
+
+    // 목표까지 추정 거리 (직선 이동과 순간이동 경유 중 작은 값, 실제 거리를 넘지 않음)
+    int manhattanToTarget(int x, int y) const;
+    int estimate(int x, int y) const;
+};
+
+#endif // AUTOPILOT_POLICY_HPP
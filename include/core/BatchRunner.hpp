@@ -0,0 +1,81 @@
+#ifndef BATCH_RUNNER_HPP
+#define BATCH_RUNNER_HPP
+
+#include "InputPolicy.hpp"
+#include "Simulation.hpp"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+// 배치 실행 설정
+struct BatchConfig {
+    int gameCount = 100;
+    int width = 31;
+    int height = 31;
+    uint64_t baseSeed = 1;     // 게임 i의 시드는 baseSeed와 i에서 유도
+    int threadCount = 0;       // 0이면 하드웨어 스레드 수
+    long long maxTicks = 20000;  // 끝나지 않는 게임을 끊는 틱 상한
+};
+
+// 게임 하나의 결과 (ScoreManager 기준)
+struct GameResult {
+    uint64_t seed = 0;
+    int score = 0;
+    int maxLength = 0;
+    int gatesUsed = 0;        // 모든 스테이지 누적
+    long long survivalTicks = 0;
+    int stageReached = 1;
+    bool completed = false;   // 마지막 스테이지까지 클리어
+    bool truncated = false;   // maxTicks에 도달해 중단
+};
+
+// 배치 전체 요약
+struct BatchSummary {
+    int gameCount = 0;
+    int completedCount = 0;
+    int truncatedCount = 0;
+    double meanScore = 0.0;
+    int bestScore = 0;
+    double meanMaxLength = 0.0;
+    int bestMaxLength = 0;
+    double meanGatesUsed = 0.0;
+    double meanSurvivalTicks = 0.0;
+    long long longestSurvivalTicks = 0;
+    long long totalTicks = 0;
+    std::vector<int> stageReachedCounts;  // [스테이지 번호] = 게임 수
+    double elapsedSeconds = 0.0;
+};
+
+// 독립된 헤드리스 게임 N개를 작업 훔치기 스레드 풀에서 실행
+class BatchRunner {
+public:
+    // 게임 시드를 받아 그 게임 전용 입력 정책 생성 (스레드 간 공유 금지)
+    using PolicyFactory = std::function<std::unique_ptr<InputPolicy>(uint64_t seed)>;
+
+    BatchRunner(const BatchConfig& config, PolicyFactory policyFactory);
+
+    // 모든 게임 실행 (결과는 게임 인덱스 순서, 스레드 수와 무관하게 동일)
+    const std::vector<GameResult>& run();
+
+    const std::vector<GameResult>& getResults() const { return results; }
+    const BatchSummary& getSummary() const { return summary; }
+
+    // 게임 하나 실행
+    static GameResult playGame(const BatchConfig& config, uint64_t seed, InputPolicy& policy);
+
+    // 게임 인덱스별 시드 (기본 시드에서 갈라진 스트림)
+    static uint64_t gameSeed(uint64_t baseSeed, int gameIndex);
+
+    static BatchSummary summarize(const std::vector<GameResult>& results);
+    static void writeSummary(std::ostream& out, const BatchSummary& summary);
+
+private:
+    BatchConfig config;
+    PolicyFactory policyFactory;
+    std::vector<GameResult> results;
+    BatchSummary summary;
+};
+
+#endif // BATCH_RUNNER_HPP
@@ -0,0 +1,64 @@
+#ifndef CELL_INDEX_HPP
+#define CELL_INDEX_HPP
+
+#include "CowArray.hpp"
+#include "StateStream.hpp"
+#include <cstddef>
+
+// 셀 인덱스 집합 (밀집 배열 + 셀→슬롯 맵)
+// 추가/삭제/포함 여부 확인이 O(1)이고, 슬롯 번호로 균등 추출 가능
+// 삭제 시 마지막 원소를 빈 슬롯으로 옮기므로 슬롯 순서는 보장되지 않음
+// 복사하면 배열을 청크 단위로 공유 (포크한 맵은 바뀐 청크만 복제)
+// assignRect()로 채운 직사각형 영역은 규칙으로 계산하므로 바뀐 청크만 할당 (큰 맵의 빈 칸 집합용)
+class CellIndex {
+public:
+    explicit CellIndex(size_t cellCount = 0);
+
+    // 관리할 셀 개수 설정 (기존 내용은 비워짐)
+    void reset(size_t cellCount);
+
+    // 관리할 셀 개수를 설정하고 직사각형 영역(stride 기준 행 우선 인덱스)의 셀을 모두 넣음
+    // 슬롯 번호는 영역 안의 행 우선 순서 (insert를 차례로 호출한 결과와 같음)
+    void assignRect(size_t cellCount, int stride, int left, int top, int rectWidth, int rectHeight);
+
+    void insert(int cell);
+    void erase(int cell);
+    void clear();
+
+    bool contains(int cell) const { return findSlot(cell) >= 0; }
+    size_t size() const { return cells.size(); }
+    bool empty() const { return cells.empty(); }
+
+    // 슬롯 번호(0 ~ size()-1)로 셀 인덱스 조회
+    int operator[](size_t slot) const {
+        int cell = cells[slot];
+        return cell == IMPLICIT ? rectCell(slot) : cell;
+    }
+
+    // 스냅샷 저장/복원 (슬롯 순서까지 그대로 - 슬롯 번호로 추출하는 난수 결과가 같아지도록)
+    void saveState(StateWriter& out) const;
+    bool loadState(StateReader& in);
+
+private:
+    // assignRect() 이후 한 번도 쓰지 않은 자리 (값은 직사각형 규칙으로 계산)
+    static const int IMPLICIT = -2;
+
+    CowArray<int> cells;   // 집합에 속한 셀 인덱스 (밀집 배열)
+    CowArray<int> slotOf;  // 셀 인덱스 → cells 내 위치 (-1이면 없음)
+
+    // assignRect()로 채운 영역 (rectWidth가 0이면 없음)
+    int stride;
+    int rectLeft;
+    int rectTop;
+    int rectWidth;
+    int rectHeight;
+
+    int findSlot(int cell) const;
+    int rectCell(size_t slot) const {
+        int row = static_cast<int>(slot / rectWidth);
+        int column = static_cast<int>(slot % rectWidth);
+        return (rectTop + row) * stride + rectLeft + column;
+    }
+};
+
+#endif // CELL_INDEX_HPP
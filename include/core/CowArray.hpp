@@ -0,0 +1,98 @@
+#ifndef COW_ARRAY_HPP
+#define COW_ARRAY_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// 청크 단위 copy-on-write 배열 (게임 포크용)
+// - 복사하면 청크 포인터만 공유하고, 공유 중인 청크에 쓰는 순간 그 청크만 복제
+// - assign()은 같은 값의 청크 하나를 모든 자리에서 공유하므로 실제 할당은 처음 쓸 때 일어남
+// - 한 객체를 여러 스레드가 동시에 쓰면 안 되지만, 포크된 객체들은 각자 다른 스레드에서 사용 가능
+template <typename T, int CHUNK_SHIFT = 8>
+class CowArray {
+public:
+    static constexpr size_t CHUNK_SIZE = static_cast<size_t>(1) << CHUNK_SHIFT;
+    static constexpr size_t CHUNK_MASK = CHUNK_SIZE - 1;
+
+    CowArray() : count(0) {}
+    explicit CowArray(size_t size, const T& value = T()) : count(0) { assign(size, value); }
+
+    void assign(size_t size, const T& value) {
+        chunks.clear();
+        count = size;
+        size_t chunkCount = (size + CHUNK_MASK) >> CHUNK_SHIFT;
+        if (chunkCount > 0) {
+            auto filled = std::make_shared<Chunk>();
+            filled->fill(value);
+            chunks.assign(chunkCount, filled);
+        }
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    const T& operator[](size_t i) const { return (*chunks[i >> CHUNK_SHIFT])[i & CHUNK_MASK]; }
+
+    // 쓰기용 참조 (청크를 다른 배열과 공유 중이면 먼저 복제)
+    T& write(size_t i) {
+        std::shared_ptr<Chunk>& chunk = chunks[i >> CHUNK_SHIFT];
+        if (chunk.use_count() != 1) {
+            chunk = std::make_shared<Chunk>(*chunk);
+        }
+        return (*chunk)[i & CHUNK_MASK];
+    }
+
+    // 값이 같으면 복제하지 않음
+    void set(size_t i, const T& value) {
+        if (!((*this)[i] == value)) {
+            write(i) = value;
+        }
+    }
+
+    // 끝 추가/제거 (밀집 목록용)
+    void push_back(const T& value) {
+        if (count == chunks.size() * CHUNK_SIZE) {
+            chunks.push_back(std::make_shared<Chunk>());
+        }
+        write(count++) = value;
+    }
+    void pop_back() {
+        count--;
+        if ((count & CHUNK_MASK) == 0) {
+            chunks.pop_back();
+        }
+    }
+    const T& back() const { return (*this)[count - 1]; }
+    void clear() {
+        chunks.clear();
+        count = 0;
+    }
+
+    // 청크 단위 연속 구간 (chunk번째 청크의 유효 원소 수는 getChunkLength)
+    size_t getChunkCount() const { return chunks.size(); }
+    const T* getChunkData(size_t chunk) const { return chunks[chunk]->data(); }
+    size_t getChunkLength(size_t chunk) const {
+        return chunk + 1 < chunks.size() ? CHUNK_SIZE : count - (chunk << CHUNK_SHIFT);
+    }
+
+    // 다른 배열과 공유하지 않는 청크 수 (포크 이후 실제로 복제된 양 확인용)
+    size_t getOwnedChunkCount() const {
+        size_t owned = 0;
+        for (const auto& chunk : chunks) {
+            if (chunk.use_count() == 1) {
+                owned++;
+            }
+        }
+        return owned;
+    }
+
+private:
+    using Chunk = std::array<T, CHUNK_SIZE>;
+
+    std::vector<std::shared_ptr<Chunk>> chunks;
+    size_t count;
+};
+
+#endif // COW_ARRAY_HPP
@@ -0,0 +1,81 @@
+#ifndef DISTANCE_FIELD_CACHE_HPP
+#define DISTANCE_FIELD_CACHE_HPP
+
+#include "Simulation.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// 목표(아이템, Gate 칸)마다 BFS 거리장을 보관하는 캐시
+// - 거리장[칸] = 그 칸에서 목표까지 열린 칸만 지나는 최단 이동 수 (목표 칸은 값과 무관하게 0)
+// - 열린 칸: 빈 칸, Growth, Speed (AutopilotPolicy::isPassableCell과 같은 기준)
+// - sync()는 GameMap의 셀 변경 기록만 읽어, 열린 칸이 생기면 거리가 줄어드는 영역만,
+//   막힌 칸이 생기면 그 칸을 거쳐 가던 영역만 다시 계산 (Temporary Wall 생성/만료, 뱀 이동)
+// - 새 목표만 전체 BFS, 사라진 목표의 거리장 버퍼는 재사용
+// - 기록이 밀려났거나 바뀐 셀이 너무 많으면(스테이지 전환 등) 전체 다시 계산
+class DistanceFieldCache {
+public:
+    static const int UNREACHABLE = -1;
+
+    // simulation은 캐시보다 오래 살아 있어야 함 (생성 시 전체 계산)
+    explicit DistanceFieldCache(const Simulation& simulation);
+
+    // 마지막 동기화 이후 바뀐 목표와 셀만 반영
+    void sync();
+
+    // 모든 거리장을 현재 맵으로 다시 계산
+    void rebuildAll();
+
+    // (x, y)에서 목표 (targetX, targetY)까지 거리 (목표가 없거나 갈 수 없으면 UNREACHABLE)
+    // 막힌 칸(뱀 머리 등)은 인접한 열린 칸을 거쳐 가는 거리
+    int getDistance(int targetX, int targetY, int x, int y) const;
+
+    // 맵 값이 cellValue인 목표(예: Growth 5, Gate 7) 중 가장 가까운 곳까지 거리
+    int getNearestDistance(int cellValue, int x, int y) const;
+
+    int getFieldCount() const { return static_cast<int>(fields.size()); }
+    bool hasTarget(int x, int y) const { return findField(y * width + x) != nullptr; }
+    bool wasLastSyncFull() const { return lastSyncFull; }
+    long long getLastRepairedCount() const { return lastRepairedCount; }  // 마지막 동기화에서 다시 쓴 거리 수
+
+    static bool isOpenCell(int cellValue);
+
+private:
+    struct Field {
+        int target;  // 목표 셀 인덱스
+        std::vector<int> distance;
+    };
+
+    const Simulation& simulation;
+    int width;
+    int height;
+    std::vector<uint8_t> open;  // 마지막 동기화 시점의 열린 칸 여부
+    std::vector<Field> fields;
+    std::vector<std::vector<int>> spareDistances;  // 사라진 목표의 버퍼
+    std::vector<int> targets;                      // 현재 목표 (동기화용)
+
+    // 영향받는 칸 표시 (세대 번호로 구분해 지우지 않고 재사용)
+    std::vector<uint32_t> mark;
+    uint32_t generation;
+    std::vector<int> queue;
+    std::vector<std::pair<int, int>> heap;  // (거리, 칸) 최소 힙
+
+    uint64_t syncedChangeCount;
+    bool lastSyncFull;
+    long long lastRepairedCount;
+
+    void collectTargets();
+    const Field* findField(int target) const;
+    void addField(int target);
+    void computeField(Field& field);
+    void nextGeneration();
+
+    // index 칸이 열리거나 막힌 뒤 거리장 보정
+    void repairOpened(Field& field, int index);
+    void repairBlocked(Field& field, int index);
+
+    // 표시되지 않은 이웃 중 distance가 정확히 d - 1인 칸이 있는지
+    bool hasSupport(const Field& field, int index) const;
+};
+
+#endif // DISTANCE_FIELD_CACHE_HPP
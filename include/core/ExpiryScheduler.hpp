@@ -0,0 +1,43 @@
+#ifndef EXPIRY_SCHEDULER_HPP
+#define EXPIRY_SCHEDULER_HPP
+
+#include "GameClock.hpp"
+#include "StateStream.hpp"
+#include <vector>
+#include <cstddef>
+
+// 만료 시각 최소 힙 (아이템/Gate/Temporary Wall 매니저가 공통으로 사용)
+// 키는 매니저가 정하는 정수(보통 셀 인덱스)이며, 엔티티를 일찍 제거해도
+// 힙에서 지우지 않음 - 꺼낸 키가 실제로 만료되었는지는 매니저가 확인
+class ExpiryScheduler {
+public:
+    ExpiryScheduler();
+
+    // 만료 시각 등록
+    void schedule(int key, GameClock::time_point deadline);
+
+    // now 이전에 만료 예정인 키를 모두 꺼내 out에 추가 (없으면 O(1))
+    void popDue(GameClock::time_point now, std::vector<int>& out);
+
+    bool hasDue(GameClock::time_point now) const { return !heap.empty() && heap.front().deadline <= now; }
+    size_t size() const { return heap.size(); }
+    bool empty() const { return heap.empty(); }
+    void clear() { heap.clear(); }
+
+    // 스냅샷 저장/복원 (힙 배열 순서 그대로, 이미 제거된 엔티티의 항목도 포함)
+    void saveState(StateWriter& out) const;
+    bool loadState(StateReader& in, size_t maxEntries);
+
+private:
+    struct Entry {
+        GameClock::time_point deadline;
+        int key;
+    };
+
+    // deadline이 가장 빠른 항목이 heap.front()
+    std::vector<Entry> heap;
+
+    static bool later(const Entry& a, const Entry& b) { return a.deadline > b.deadline; }
+};
+
+#endif // EXPIRY_SCHEDULER_HPP
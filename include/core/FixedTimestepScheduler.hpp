@@ -0,0 +1,70 @@
+#ifndef FIXED_TIMESTEP_SCHEDULER_HPP
+#define FIXED_TIMESTEP_SCHEDULER_HPP
+
+#include <chrono>
+
+// 고정 시간 간격 틱 스케줄러 (ncurses 의존성 없음, 현재 시각은 호출자가 전달)
+// - 마감 시각을 틱 길이의 정확한 배수로 진행 (대기 지연이 누적되지 않음)
+// - 멈췄다 돌아오면 한 프레임에 따라잡는 틱 수를 제한하고 나머지는 버림
+// - 밀려 있는 동안에는 틱보다 렌더 프레임을 먼저 건너뜀
+// - 실제 틱 속도와 지터(마감 대비 실행 지연)를 1초 단위로 측정
+class FixedTimestepScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using time_point = Clock::time_point;
+    using duration = Clock::duration;
+
+    explicit FixedTimestepScheduler(int maxCatchUpTicks = 5, int maxSkippedFrames = 5);
+
+    // 시작 (첫 마감 시각은 now + tickDuration)
+    void start(time_point now, duration tickDuration);
+
+    // 프레임 시작: 이번 프레임의 기준 시각 설정, 너무 밀린 틱은 버림
+    void beginFrame(time_point now);
+
+    // 실행할 틱이 있으면 true (한 틱씩 소비, 프레임당 최대 maxCatchUpTicks)
+    bool consumeTick();
+
+    // 틱 길이 변경 (속도 부스트) - 방금 실행한 틱의 다음 마감부터 적용
+    void setTickDuration(duration tickDuration);
+
+    // 틱 처리 후 이번 프레임을 그려야 하는지
+    // (틱 처리 중에 다음 마감이 지나 버렸으면 건너뜀, 연속 건너뛰기는 제한)
+    bool shouldRender(time_point now);
+
+    // 다음 틱 마감 시각 (이 시각까지 대기)
+    time_point getNextDeadline() const { return nextDeadline; }
+    duration getTickDuration() const { return tickDuration; }
+
+    // 통계
+    long long getTickCount() const { return tickCount; }
+    long long getDroppedTicks() const { return droppedTicks; }
+    long long getDroppedFrames() const { return droppedFrames; }
+    double getAchievedTickRate() const { return achievedTickRate; }  // 초당 틱 수 (직전 측정 구간)
+    double getJitterMs() const { return jitterMs; }                  // 평균 실행 지연 (직전 측정 구간)
+
+private:
+    int maxCatchUpTicks;
+    int maxSkippedFrames;
+
+    duration tickDuration;
+    time_point nextDeadline;
+    time_point lastTickDeadline;  // 마지막으로 실행한 틱의 마감 시각
+    time_point frameNow;
+    int ticksThisFrame;
+    int skippedFramesInRow;
+
+    // 통계
+    long long tickCount;
+    long long droppedTicks;
+    long long droppedFrames;
+    time_point windowStart;
+    int windowTicks;
+    double windowLatenessMs;
+    double achievedTickRate;
+    double jitterMs;
+
+    void updateWindow();
+};
+
+#endif // FIXED_TIMESTEP_SCHEDULER_HPP
@@ -0,0 +1,54 @@
+#ifndef FRAME_BUFFER_HPP
+#define FRAME_BUFFER_HPP
+
+#include <vector>
+#include <string>
+
+// 화면 한 칸 (문자 + 색상 쌍 번호)
+struct FrameCell {
+    char glyph;
+    short colorPair;
+
+    bool operator==(const FrameCell& other) const {
+        return glyph == other.glyph && colorPair == other.colorPair;
+    }
+    bool operator!=(const FrameCell& other) const { return !(*this == other); }
+};
+
+// 같은 행에서 연속으로 바뀐, 같은 색상의 칸 묶음
+struct FrameRun {
+    int x, y;
+    short colorPair;
+    std::string text;
+};
+
+// 이중 버퍼 (ncurses 의존성 없음)
+// back에 이번 프레임을 쓰고 diff()로 이전 프레임(front)과 달라진 칸만 얻음
+class FrameBuffer {
+public:
+    FrameBuffer();
+
+    // 크기 설정 (다음 diff()는 전체를 다시 그림)
+    void resize(int width, int height);
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+    // 이번 프레임 칸 설정/조회
+    void setCell(int x, int y, char glyph, short colorPair) { back[y * width + x] = FrameCell{glyph, colorPair}; }
+    const FrameCell& getCell(int x, int y) const { return back[y * width + x]; }
+
+    // 화면이 외부에서 지워졌을 때 호출 (다음 diff()는 전체를 다시 그림)
+    void invalidate() { fullRedraw = true; }
+
+    // 바뀐 칸을 행별 같은 색상 묶음으로 runs에 추가하고 front를 갱신
+    void diff(std::vector<FrameRun>& runs);
+
+private:
+    int width;
+    int height;
+    std::vector<FrameCell> front;  // 마지막으로 화면에 그린 프레임
+    std::vector<FrameCell> back;   // 이번 프레임
+    bool fullRedraw;
+};
+
+#endif // FRAME_BUFFER_HPP
@@ -1,104 +1,128 @@
 #ifndef GAME_HPP
 #define GAME_HPP
 
-#include "GameMap.hpp"
-#include "Snake.hpp"
-#include "ItemManager.hpp"
-#include "GateManager.hpp"
-#include "TemporaryWallManager.hpp"
+#include "Simulation.hpp"
+#include "MapRenderer.hpp"
 #include "ColorManager.hpp"
-#include "ScoreManager.hpp"
-#include "StageManager.hpp"
+#include "FixedTimestepScheduler.hpp"
+#include "Replay.hpp"
+#include "InputPolicy.hpp"
 #include <ncurses.h>
+#include <chrono>
 #include <memory>
+#include <string>
 
+// ncurses 프론트엔드 (게임 규칙은 Simulation이 담당)
 class Game {
 public:
     Game(int width, int height);
     ~Game();
 
     // 게임 상태
-    bool isGameOver() const { return gameOver; }
-    
+    bool isGameOver() const { return simulation.isGameOver(); }
+
     // 게임 객체 접근
-    Snake& getSnake() { return snake; }
-    const Snake& getSnake() const { return snake; }
-    GameMap& getMap() { return map; }
-    ScoreManager& getScoreManager() { return scoreManager; }
-    ItemManager& getItemManager() { return itemManager; }
-    const ItemManager& getItemManager() const { return itemManager; }
-    GateManager& getGateManager() { return gateManager; }
-    const GateManager& getGateManager() const { return gateManager; }
-    TemporaryWallManager& getTemporaryWallManager() { return temporaryWallManager; }
-    const TemporaryWallManager& getTemporaryWallManager() const { return temporaryWallManager; }
-    StageManager& getStageManager() { return stageManager; }
-    const StageManager& getStageManager() const { return stageManager; }
+    Simulation& getSimulation() { return simulation; }
+    const Simulation& getSimulation() const { return simulation; }
+    Snake& getSnake() { return simulation.getSnake(); }
+    const Snake& getSnake() const { return simulation.getSnake(); }
+    GameMap& getMap() { return simulation.getMap(); }
+    ScoreManager& getScoreManager() { return simulation.getScoreManager(); }
+    ItemManager& getItemManager() { return simulation.getItemManager(); }
+    const ItemManager& getItemManager() const { return simulation.getItemManager(); }
+    GateManager& getGateManager() { return simulation.getGateManager(); }
+    const GateManager& getGateManager() const { return simulation.getGateManager(); }
+    TemporaryWallManager& getTemporaryWallManager() { return simulation.getTemporaryWallManager(); }
+    const TemporaryWallManager& getTemporaryWallManager() const { return simulation.getTemporaryWallManager(); }
+    StageManager& getStageManager() { return simulation.getStageManager(); }
+    const StageManager& getStageManager() const { return simulation.getStageManager(); }
+    const FixedTimestepScheduler& getScheduler() const { return scheduler; }
 
     // 속도 관리
-    int getCurrentTickDuration() const { return currentTickDuration; }
-    int getBaseTickDuration() const { return baseTickDuration; }
-    int getSpeedBoostCount() const { return speedBoostCount; }
-    void applySpeedBoost();
-    void resetSpeed();
+    int getCurrentTickDuration() const { return simulation.getCurrentTickDuration(); }
+    int getBaseTickDuration() const { return simulation.getBaseTickDuration(); }
+    int getSpeedBoostCount() const { return simulation.getSpeedBoostCount(); }
+    void applySpeedBoost() { simulation.applySpeedBoost(); }
+    void resetSpeed() { simulation.resetSpeed(); }
 
     // 게임 로직
-    void update();
+    void update() { simulation.update(); }
     void handleInput(int key);
     void draw();
 
+    // 화면 배치: 터미널에서 옆 패널 자리를 뺀 만큼 맵 뷰포트로 쓰고, 옆 패널은 뷰포트 바로 오른쪽
+    // (draw()가 터미널 크기가 바뀔 때마다 호출, 뷰포트는 뱀 머리를 따라감)
+    void layoutScreen(int columns, int rows);
+    const MapViewport& getViewport() const { return renderer.getViewport(); }
+    int getSidePanelColumn() const { return renderer.getViewport().getWidth() + SIDE_PANEL_GAP; }
+
     // 게임 루프
     void run();
-    
+
+    // 리플레이 기록 (게임 종료 시 filename에 저장)
+    // 리플레이는 시드부터 재생하므로 첫 틱 전에만 시작 가능 (재개한 게임 등은 false)
+    bool recordReplayTo(const std::string& filename);
+    const Replay* getReplay() const { return replay.get(); }
+
+    // 일시 정지/재개: 's' 키로 게임 전체 상태를 파일에 저장하고 종료
+    void setSuspendFile(const std::string& filename) { suspendFilename = filename; }
+    bool saveSnapshotToFile(const std::string& filename) const;
+    bool loadSnapshotFromFile(const std::string& filename);  // 실패하면 현재 게임 유지
+    bool isSuspended() const { return suspended; }
+
+    // 오토파일럿: 매 틱 직전 정책이 고른 행동을 키 입력으로 바꿔 handleInput()에 전달
+    // (사람 입력과 같은 경로라 리플레이에도 그대로 기록됨, 사람 키 입력도 계속 받음)
+    void setAutopilot(std::unique_ptr<InputPolicy> policy) { autopilot = std::move(policy); }
+    bool hasAutopilot() const { return autopilot != nullptr; }
+    void stepAutopilot();
+
     // Temporary Wall 관련
-    void createTemporaryWallAroundSnake();
-    void createRandomTemporaryWalls();
-    
+    void createTemporaryWallAroundSnake() { simulation.createTemporaryWallAroundSnake(); }
+    void createRandomTemporaryWalls() { simulation.createRandomTemporaryWalls(); }
+
     // 자동 생성 타이머 관련
-    std::chrono::steady_clock::time_point getLastTemporaryWallCreation() const { return lastTemporaryWallCreation; }
-    void setLastTemporaryWallCreation(std::chrono::steady_clock::time_point time) { lastTemporaryWallCreation = time; }
-    int getTemporaryWallCreationInterval() const { return temporaryWallCreationInterval.count(); }
+    GameClock::time_point getLastTemporaryWallCreation() const { return simulation.getLastTemporaryWallCreation(); }
+    void setLastTemporaryWallCreation(GameClock::time_point time) { simulation.setLastTemporaryWallCreation(time); }
+    int getTemporaryWallCreationInterval() const { return simulation.getTemporaryWallCreationInterval(); }
+
+    // 키 입력을 추상 행동으로 변환
+    static GameAction keyToAction(int key);
+    // 행동을 대표 키로 변환 (NONE이면 ERR)
+    static int actionToKey(GameAction action);
+
+    // 프로파일링 빌드에서 'p' 키로 저장하는 구간별 지연 시간 요약 파일
+    static constexpr const char* PROFILE_REPORT_FILE = "tick_profile.txt";
+
+    // setSuspendFile()로 바꾸지 않았을 때의 일시 정지 파일
+    static constexpr const char* DEFAULT_SUSPEND_FILE = "snake_suspend.snks";
+
+    // 옆 패널(점수판, 미션) 폭과 맵과의 간격, 맵 뷰포트 최소 크기
+    static const int SIDE_PANEL_WIDTH;
+    static const int SIDE_PANEL_GAP;
+    static const int MIN_VIEWPORT_SIZE;
 
 private:
-    GameMap map;
-    Snake snake;
-    ItemManager itemManager;
-    GateManager gateManager;
-    TemporaryWallManager temporaryWallManager;
+    Simulation simulation;
     std::shared_ptr<ColorManager> colorManager;
-    ScoreManager scoreManager;
-    StageManager stageManager;
-    bool gameOver;
-    bool gameCompleted;
+    MapRenderer renderer;
+    int lastDrawnStage;  // 마지막으로 그린 스테이지 (바뀌면 전체 다시 그림)
+    int screenColumns;   // 마지막으로 배치한 터미널 크기 (바뀌면 다시 배치하고 전체 다시 그림)
+    int screenRows;
+    FixedTimestepScheduler scheduler;  // 틱 마감 시각 관리
+    std::unique_ptr<Replay> replay;    // 기록 중인 리플레이 (없으면 기록 안 함)
+    std::string replayFilename;
+    std::string suspendFilename;
+    bool suspended;  // 일시 정지 파일을 저장하고 루프를 빠져나가는 중
+    std::unique_ptr<InputPolicy> autopilot;  // 없으면 사람 입력만 사용
+
+    // 게임 루프: 입력이 오거나 deadline이 될 때까지 대기
+    void waitForInputOrDeadline(std::chrono::steady_clock::time_point deadline);
 
-    // 속도 관리
-    static const int baseTickDuration = 200;  // 기본 틱 지속시간 (ms)
-    static const int minTickDuration = 50;    // 최소 틱 지속시간 (ms)
-    int currentTickDuration;                  // 현재 틱 지속시간 (ms)
-    int speedBoostCount;                      // 속도 부스트 횟수
-    
-    // 자동 Temporary Wall 생성 관련
-    std::chrono::steady_clock::time_point lastTemporaryWallCreation;
-    std::chrono::milliseconds temporaryWallCreationInterval;
-
-    // 충돌 감지
-    bool checkWallCollision() const;
-    void updateMap();
-    
-    // 아이템 관련
-    void handleItemCollision();
-    
-    // Gate 관련
-    void handleGateCollision();
-    
     // 점수 표시
     void drawScoreBoard();
-    
+
     // 스테이지 관련
-    void checkStageCompletion();
     void drawMissionInfo();
-    
-    // Temporary Wall 관련 (private)
-    void checkTemporaryWallCreation();
 };
 
-#endif // GAME_HPP 
\ No newline at end of file
+#endif // GAME_HPP
@@ -0,0 +1,36 @@
+#ifndef GAME_CLOCK_HPP
+#define GAME_CLOCK_HPP
+
+#include "StateStream.hpp"
+#include <chrono>
+#include <ratio>
+
+// 게임 가상 시계 (업데이트 한 번에 한 틱씩 진행)
+// 실제 시간과 분리되어 있어 시뮬레이션을 실시간보다 빠르게 돌릴 수 있음
+class GameClock {
+public:
+    using rep = long long;
+    using period = std::milli;
+    using duration = std::chrono::milliseconds;
+    using time_point = std::chrono::time_point<GameClock, duration>;
+
+    GameClock();
+
+    // 시계 진행 (틱마다 한 번 호출)
+    void advance(duration delta);
+    void reset();
+
+    // 현재 가상 시간
+    time_point now() const { return currentTime; }
+    long long getTickCount() const { return tickCount; }
+
+    // 스냅샷 저장/복원
+    void saveState(StateWriter& out) const;
+    bool loadState(StateReader& in);
+
+private:
+    time_point currentTime;
+    long long tickCount;
+};
+
+#endif // GAME_CLOCK_HPP
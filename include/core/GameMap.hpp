@@ -1,24 +1,44 @@
 #ifndef GAME_MAP_HPP
 #define GAME_MAP_HPP
 
+#include "CellIndex.hpp"
+#include "CowArray.hpp"
+#include "StateStream.hpp"
+#include <array>
 #include <vector>
-#include <ncurses.h>
-#include "ColorManager.hpp"
-#include <memory>
+#include <cstdint>
 #include <optional>
 #include <utility>
 
+// Gate 후보 벽 셀의 위치 구분 (모서리는 어느 쪽에도 속하지 않음)
+enum class WallSide {
+    TOP,
+    BOTTOM,
+    LEFT,
+    RIGHT,
+    INNER
+};
+
+// 셀 배열과 인덱스는 청크 단위 copy-on-write라 맵 복사(포크)는 청크 포인터 복사 비용뿐
 class GameMap {
 public:
     GameMap(int width, int height);
     ~GameMap();
-    
-    // 색상 관리자 설정
-    void setColorManager(std::shared_ptr<ColorManager> colorMgr);
+
+    // 게임/리플레이가 받는 맵 한 변의 범위
+    // 최소는 스테이지 벽 배치(21x21 영역)가 들어가는 크기, 최대는 셀 배열들의 청크 포인터 표가
+    // 맵당 수십 MB를 넘지 않는 크기
+    static const int MIN_SIZE;
+    static const int MAX_SIZE;
 
     // 맵 크기 getter
     int getWidth() const { return width; }
     int getHeight() const { return height; }
+    int getStride() const { return width; }  // 한 행의 셀 개수
+
+    // 새로 만든 맵과 같은 상태로 되돌림 (크기와 버퍼는 그대로, 환경 재시작용)
+    // 변경 기록은 이어서 쌓이며, 소비자는 hasChangesSince()가 false가 되어 전체를 다시 읽음
+    void reset();
 
     // 셀 값 getter/setter
     int getCellValue(int x, int y) const;
@@ -28,6 +48,38 @@ public:
     int getCell(int x, int y) const { return getCellValue(x, y); }
     void setCell(int x, int y, int value) { setCellValue(x, y, value); }
 
+    // 경계 검사 없는 셀 접근 (내부 전체 맵 순회용, 좌표는 호출자가 보장)
+    uint8_t getCellUnchecked(int x, int y) const { return cells[y * width + x]; }
+    void setCellUnchecked(int x, int y, uint8_t value) {
+        int index = y * width + x;
+        uint8_t cell = cells[index];
+        if (cell == value) {
+            return;
+        }
+        if ((cell == 0) != (value == 0) || isWallValue(cell) != isWallValue(value)) {
+            updateCellIndices(x, y, value);
+        }
+        cells.write(index) = value;
+        changeJournal.write(changeCount++ & changeJournalMask) = index;
+    }
+
+    // 행 우선 셀 인덱스(y * stride + x)로 접근
+    uint8_t getCellAt(int index) const { return cells[index]; }
+    void copyCellsTo(uint8_t* out) const;  // 행 우선 연속 배열로 복사 (width * height 바이트)
+
+    // 셀 값 변경 기록 (관측 등 외부 소비자용 링 버퍼, 인덱스 = y * stride + x)
+    // 변경 번호 since 이후의 기록이 아직 남아 있으면 getChangedCell(since..getChangeCount()-1)로 조회
+    uint64_t getChangeCount() const { return changeCount; }
+    bool hasChangesSince(uint64_t since) const { return changeCount - since <= changeJournal.size(); }
+    int getChangedCell(uint64_t sequence) const { return changeJournal[sequence & changeJournalMask]; }
+
+    // 변경된 셀 추적 (증분 맵 갱신용, 인덱스 = y * stride + x)
+    void markDirty(int x, int y);
+    void markAllDirty() { allDirty = true; }  // 스테이지 적용 등 전체 재구성이 필요할 때
+    bool isAllDirty() const { return allDirty; }
+    const std::vector<int>& getDirtyCells() const { return dirtyCells; }
+    void clearDirty();
+
     // 특정 타입의 셀 설정
     void setWall(int x, int y);
     void setSnakeHead(int x, int y);
@@ -41,16 +93,51 @@ public:
     // 안전한 위치 찾기 (뱀 초기화용)
     std::optional<std::pair<int, int>> findSafePosition() const;
 
-    // 맵 그리기
-    void draw() const;
+    // 빈 내부 셀(값 0) 인덱스 (셀 쓰기와 함께 갱신, 슬롯 번호로 균등 추출)
+    int getFreeCellCount() const { return static_cast<int>(freeCells.size()); }
+    std::pair<int, int> getFreeCell(int slot) const { return cellPosition(freeCells[slot]); }
+
+    // Gate 후보 벽 셀(값 1, 2) 인덱스, 위치별로 구분 (모서리 제외)
+    static constexpr int WALL_SIDE_COUNT = 5;
+    const CellIndex& getWallCells(WallSide side) const { return wallCells[static_cast<int>(side)]; }
+    WallSide getWallSide(int x, int y) const;
+    std::pair<int, int> cellPosition(int index) const { return std::make_pair(index % width, index / width); }
+
+    // 스냅샷 저장/복원 (셀, 변경 표시, 빈 셀/벽 셀 인덱스의 슬롯 순서)
+    // 셀 값이 0~9를 벗어나거나 인덱스가 셀과 어긋나면 실패
+    // 복원으로 바뀐 셀은 변경 기록에 남으므로 관측 소비자는 증분 동기화를 그대로 사용 가능
+    void saveState(StateWriter& out) const;
+    bool loadState(StateReader& in);
 
 private:
     int width;
     int height;
-    std::vector<std::vector<int>> map;
-    std::shared_ptr<ColorManager> colorManager;
+    CowArray<uint8_t> cells;  // 행 우선 배열 (셀 값은 0~9)
+
+    // 변경된 셀 목록과 중복 방지 플래그
+    std::vector<int> dirtyCells;
+    CowArray<uint8_t> dirtyFlags;
+    bool allDirty;
+
+    // 셀 값 변경 기록 (크기는 2의 거듭제곱, 오래된 기록부터 덮어씀)
+    CowArray<int> changeJournal;
+    uint64_t changeJournalMask;
+    uint64_t changeCount;
+
+    // 빈 내부 셀 집합 (테두리는 포함하지 않음)
+    CellIndex freeCells;
+
+    // 위치별 벽 셀 집합
+    std::array<CellIndex, WALL_SIDE_COUNT> wallCells;
+
+    static bool isWallValue(uint8_t value) { return value == 1 || value == 2; }
+    static const uint8_t MAX_CELL_VALUE = 9;  // Temporary Wall
+
+    // 빈 셀/벽 셀 인덱스가 셀 값과 정확히 같은 집합인지 (스냅샷 복원 검증)
+    bool indicesMatchCells() const;
 
     void initializeMap();
+    void updateCellIndices(int x, int y, uint8_t newValue);
 };
 
 #endif // GAME_MAP_HPP 
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef GAME_RNG_HPP
+#define GAME_RNG_HPP
+
+#include "StateStream.hpp"
+#include <cstdint>
+#include <limits>
+
+// 게임당 하나의 시드로 재현 가능한 빠른 난수 생성기 (xoshiro256**)
+// - 상태 32바이트, 추출 한 번에 시프트/회전 몇 번 (mt19937의 5KB 상태 초기화 없음)
+// - split(stream)으로 매니저마다 독립된 스트림을 만들어 서로의 추출 순서에 영향을 주지 않음
+// - std::shuffle 등에 바로 쓸 수 있는 UniformRandomBitGenerator
+class GameRng {
+public:
+    using result_type = uint64_t;
+
+    explicit GameRng(uint64_t seed = 0);
+
+    void seed(uint64_t seed);
+
+    // 이 생성기 상태와 stream 번호로 독립된 생성기 유도 (이 생성기는 진행하지 않음)
+    GameRng split(uint64_t stream) const;
+
+    result_type operator()() { return next(); }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    uint64_t next() {
+        uint64_t result = rotl(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    // [0, bound) 균등 정수 (bound > 0, 곱셈-시프트 + 드문 재추첨으로 편향 없음)
+    int uniformInt(int bound) {
+        uint64_t range = static_cast<uint64_t>(bound);
+        __uint128_t product = static_cast<__uint128_t>(next()) * range;
+        uint64_t low = static_cast<uint64_t>(product);
+        if (low < range) {
+            uint64_t threshold = (0 - range) % range;
+            while (low < threshold) {
+                product = static_cast<__uint128_t>(next()) * range;
+                low = static_cast<uint64_t>(product);
+            }
+        }
+        return static_cast<int>(product >> 64);
+    }
+
+    // [low, high] 균등 정수
+    int uniformInt(int low, int high) { return low + uniformInt(high - low + 1); }
+
+    // percent% 확률로 true
+    bool chance(int percent) { return uniformInt(100) < percent; }
+
+    // 스냅샷 저장/복원 (상태 32바이트 그대로)
+    void saveState(StateWriter& out) const;
+    bool loadState(StateReader& in);
+
+    // 시드 확장/유도용 splitmix64
+    static uint64_t splitMix64(uint64_t& x);
+
+    // 시드를 지정하지 않은 게임용 (random_device는 여기서 한 번만 사용)
+    static uint64_t randomSeed();
+
+private:
+    uint64_t state[4];
+
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+};
+
+#endif // GAME_RNG_HPP
@@ -0,0 +1,44 @@
+#ifndef INPUT_POLICY_HPP
+#define INPUT_POLICY_HPP
+
+#include "Simulation.hpp"
+#include "GameRng.hpp"
+#include <cstdint>
+
+// 헤드리스 게임에서 매 틱 행동을 고르는 입력 정책 (봇)
+class InputPolicy {
+public:
+    virtual ~InputPolicy() = default;
+
+    // update() 직전에 호출, 반환한 행동은 applyAction으로 적용됨
+    virtual GameAction chooseAction(const Simulation& simulation) = 0;
+};
+
+// 일정 확률로 무작위 방향 전환
+class RandomTurnPolicy : public InputPolicy {
+public:
+    explicit RandomTurnPolicy(uint64_t seed, int turnPercent = 10);
+
+    GameAction chooseAction(const Simulation& simulation) override;
+
+private:
+    GameRng rng;
+    int turnPercent;
+};
+
+// 다음 칸이 안전한 방향 중에서 선택 (인접한 Growth/Speed 아이템 우선, 없으면 직진 유지)
+class SafeMovePolicy : public InputPolicy {
+public:
+    explicit SafeMovePolicy(uint64_t seed, int turnPercent = 5);
+
+    GameAction chooseAction(const Simulation& simulation) override;
+
+    // 뱀 머리가 들어가도 죽지 않는 맵 값인지 (빈 칸, 아이템, Gate)
+    static bool isSafeCell(int cellValue);
+
+private:
+    GameRng rng;
+    int turnPercent;
+};
+
+#endif // INPUT_POLICY_HPP
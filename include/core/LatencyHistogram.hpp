@@ -0,0 +1,43 @@
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+
+#include <array>
+#include <cstdint>
+
+// 로그-선형 지연 시간 히스토그램 (단위: 나노초)
+// 2의 거듭제곱 구간마다 16개의 선형 하위 구간으로 나누어 상대 오차 6.25% 이내,
+// 기록은 분기 없는 O(1) (비트 연산 + 카운터 증가)
+class LatencyHistogram {
+public:
+    static const int SUB_BUCKET_BITS = 4;
+    static const int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static const int BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    LatencyHistogram();
+
+    void record(uint64_t value);
+    void merge(const LatencyHistogram& other);
+    void reset();
+
+    // q는 0~1 (0.5 = p50), 해당 구간의 대표값 반환 (기록이 없으면 0)
+    uint64_t percentile(double q) const;
+
+    uint64_t getCount() const { return count; }
+    uint64_t getMin() const { return count > 0 ? minValue : 0; }
+    uint64_t getMax() const { return maxValue; }
+    double getMean() const { return count > 0 ? static_cast<double>(sum) / count : 0.0; }
+
+    // 구간 계산 (테스트용 공개)
+    static int bucketIndex(uint64_t value);
+    static uint64_t bucketLowerBound(int index);
+    static uint64_t bucketWidth(int index);
+
+private:
+    std::array<uint64_t, BUCKET_COUNT> buckets;
+    uint64_t count;
+    uint64_t sum;
+    uint64_t minValue;
+    uint64_t maxValue;
+};
+
+#endif // LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,46 @@
+#ifndef MAP_RENDERER_HPP
+#define MAP_RENDERER_HPP
+
+#include "GameMap.hpp"
+#include "ColorManager.hpp"
+#include "FrameBuffer.hpp"
+#include "MapViewport.hpp"
+#include <ncurses.h>
+#include <memory>
+#include <vector>
+
+// GameMap을 ncurses 화면에 그리는 클래스
+// 이전 프레임과 비교해 바뀐 칸만 같은 색상 묶음 단위로 출력 (refresh는 호출자가 담당)
+// 화면보다 큰 맵은 뷰포트 안의 칸만 읽으므로 그리기 비용은 맵 크기가 아니라 화면 크기에 비례
+class MapRenderer {
+public:
+    MapRenderer();
+    ~MapRenderer();
+
+    // 색상 관리자 설정
+    void setColorManager(std::shared_ptr<ColorManager> colorMgr);
+
+    // 맵 그리기 (현재 카메라 위치에서 보이는 영역만)
+    void draw(const GameMap& map);
+    // 카메라가 (focusX, focusY)를 따라가게 한 뒤 그리기
+    void draw(const GameMap& map, int focusX, int focusY);
+
+    // 보이는 영역 (setScreenSize로 화면 크기 제한, 기본은 맵 전체)
+    MapViewport& getViewport() { return viewport; }
+    const MapViewport& getViewport() const { return viewport; }
+
+    // 화면을 clear()한 뒤 호출 (다음 draw에서 전체를 다시 그림)
+    void invalidate() { frameBuffer.invalidate(); }
+
+    // 셀 값별 표시 문자와 색상
+    static char getGlyph(int cellValue);
+    static ColorType getColorType(int cellValue);
+
+private:
+    std::shared_ptr<ColorManager> colorManager;
+    MapViewport viewport;
+    FrameBuffer frameBuffer;
+    std::vector<FrameRun> runs;  // 프레임마다 재사용
+};
+
+#endif // MAP_RENDERER_HPP
@@ -0,0 +1,44 @@
+#ifndef MAP_VIEWPORT_HPP
+#define MAP_VIEWPORT_HPP
+
+// 맵에서 화면에 보이는 직사각형 영역 (카메라, ncurses 의존성 없음)
+// - 화면보다 큰 맵은 따라갈 칸(뱀 머리)이 가장자리 여백에 들어올 때만 그 칸을 가운데로 옮김
+//   (매 틱 한 칸씩 스크롤하면 보이는 칸이 전부 바뀌어 매 프레임 화면 전체를 다시 그려야 함)
+// - 카메라는 맵 밖으로 나가지 않으며, 맵이 화면보다 작은 축은 항상 0
+class MapViewport {
+public:
+    MapViewport();
+
+    // 맵을 그릴 수 있는 최대 화면 크기 (0 이하면 제한 없음 - 맵 전체를 보여줌)
+    void setScreenSize(int columns, int rows);
+    int getScreenColumns() const { return screenColumns; }
+    int getScreenRows() const { return screenRows; }
+
+    // 맵 크기에 맞춰 보이는 크기를 정하고 (focusX, focusY)가 여백 안쪽에 오도록 카메라 이동
+    void follow(int mapWidth, int mapHeight, int focusX, int focusY);
+
+    // 보이는 영역 (맵 좌표)
+    int getX() const { return x; }
+    int getY() const { return y; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    bool contains(int mapX, int mapY) const {
+        return mapX >= x && mapX < x + width && mapY >= y && mapY < y + height;
+    }
+
+    // 가장자리 여백 칸 수 (보이는 크기가 작으면 줄어듦)
+    static const int EDGE_MARGIN;
+
+private:
+    int screenColumns;
+    int screenRows;
+    int x;
+    int y;
+    int width;
+    int height;
+
+    // 한 축의 카메라 위치 계산
+    static int followAxis(int origin, int focus, int mapSize, int viewSize);
+};
+
+#endif // MAP_VIEWPORT_HPP
@@ -0,0 +1,41 @@
+#ifndef NAVIGATION_GRAPH_HPP
+#define NAVIGATION_GRAPH_HPP
+
+#include "Simulation.hpp"
+#include <vector>
+
+// 경로 탐색용 이동 그래프: 맵 격자 인접 칸 + Gate 순간이동 간선
+// - 노드는 셀 인덱스(y * width + x), 간선 하나가 한 틱 이동
+// - Gate 칸으로 들어가는 이동은 GateManager가 쌍 생성 때 계산한 간선을 따라 출구 칸에 도착하므로
+//   탐색 중에 Gate 진출 규칙을 다시 계산하지 않음
+// - 생성 시점의 맵 기준 읽기 전용 뷰 (맵이 바뀌면 새로 만들어야 함, 생성 비용은 간선 수에 비례)
+class NavigationGraph {
+public:
+    // 순간이동 간선 (출구까지 확정된 것만)
+    struct Teleport {
+        int from;       // 진입 직전 칸
+        int direction;  // 진입 방향 (Direction 순서)
+        int exit;       // 도착 칸
+    };
+
+    explicit NavigationGraph(const Simulation& simulation);
+
+    // index 칸에서 direction(Direction 순서 UP, DOWN, LEFT, RIGHT) 방향으로 한 틱 이동한 도착 칸
+    // 막혔거나 출구가 모두 막힌 Gate면 -1
+    int step(int index, int direction) const;
+
+    const std::vector<Teleport>& getTeleports() const { return teleports; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+    // 지나갈 수 있는 맵 값 (빈 칸, Growth, Speed), Gate는 순간이동 간선으로만 지나감
+    static bool isPassableCell(int cellValue) { return cellValue == 0 || cellValue == 5 || cellValue == 8; }
+
+private:
+    const GameMap& map;
+    int width;
+    int height;
+    std::vector<Teleport> teleports;
+};
+
+#endif // NAVIGATION_GRAPH_HPP
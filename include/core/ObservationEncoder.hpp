@@ -0,0 +1,74 @@
+#ifndef OBSERVATION_ENCODER_HPP
+#define OBSERVATION_ENCODER_HPP
+
+#include "GameMap.hpp"
+#include "Position.hpp"
+#include <cstddef>
+#include <cstdint>
+
+// 관측 특징 평면 (맵 셀 값 하나당 평면 하나, 빈 칸은 어느 평면에도 없음)
+enum class ObservationPlane {
+    WALL,            // 1
+    IMMUNE_WALL,     // 2
+    HEAD,            // 3
+    BODY,            // 4
+    GROWTH,          // 5
+    POISON,          // 6
+    GATE,            // 7
+    SPEED,           // 8
+    TEMPORARY_WALL,  // 9
+    COUNT
+};
+
+// 게임 맵을 uint8 특징 평면 묶음으로 호출자 버퍼에 기록
+// 버퍼 배치: planes[plane * height * width + y * width + x] = 0 또는 1
+// 한 번 전체를 쓴 뒤에는 GameMap의 셀 변경 기록만 반영 (기록이 밀려났으면 전체 다시 씀)
+// 셀 값 자체가 필요하면 복사 없이 GameMap::getCellAt()/copyCellsTo()를 사용
+class ObservationEncoder {
+public:
+    static const int PLANE_COUNT = static_cast<int>(ObservationPlane::COUNT);
+
+    // buffer는 getBufferSize() 바이트 이상, 인코더보다 오래 살아 있어야 함
+    ObservationEncoder(const GameMap& map, uint8_t* buffer);
+
+    static size_t getBufferSize(int width, int height) {
+        return static_cast<size_t>(PLANE_COUNT) * width * height;
+    }
+    size_t getBufferSize() const { return getBufferSize(map.getWidth(), map.getHeight()); }
+
+    // 마지막 동기화 이후 바뀐 셀만 반영 (처음이거나 기록이 밀려났으면 전체 인코딩)
+    void sync();
+
+    // 전체 다시 인코딩
+    void encodeAll();
+
+    const uint8_t* getPlane(ObservationPlane plane) const {
+        return buffer + static_cast<size_t>(plane) * map.getWidth() * map.getHeight();
+    }
+    bool wasLastSyncFull() const { return lastSyncFull; }
+
+    // 셀 값 → 평면 번호 (빈 칸/알 수 없는 값은 -1)
+    static int planeForCell(int cellValue) {
+        return (cellValue >= 1 && cellValue <= PLANE_COUNT) ? cellValue - 1 : -1;
+    }
+
+    // center를 중심으로 한 (2 * radius + 1)^2 크기 자기중심 잘라내기
+    // out 배치: out[plane * side * side + dy * side + dx], 맵 밖은 IMMUNE_WALL로 채움
+    // 맵 셀에서 직접 계산하므로 큰 맵에서도 비용은 잘라낸 크기에만 비례
+    static size_t getCropBufferSize(int radius) {
+        size_t side = 2 * static_cast<size_t>(radius) + 1;
+        return static_cast<size_t>(PLANE_COUNT) * side * side;
+    }
+    static void encodeCrop(const GameMap& map, const Position& center, int radius, uint8_t* out);
+
+private:
+    const GameMap& map;
+    uint8_t* buffer;
+    uint64_t syncedChangeCount;
+    bool initialized;
+    bool lastSyncFull;
+
+    void encodeCell(int index);
+};
+
+#endif // OBSERVATION_ENCODER_HPP
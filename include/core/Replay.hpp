@@ -0,0 +1,77 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include "Simulation.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 리플레이 입력 기록 (tick번째 update() 직전에 적용된 행동)
+struct ReplayEvent {
+    long long tick;
+    GameAction action;
+};
+
+// 기록 종료 시점의 ScoreManager 결과 (재생 검증용)
+struct ReplayTotals {
+    int score = 0;
+    int maxLength = 0;
+    int currentLength = 0;
+    int gatesUsed = 0;       // 스테이지 누적
+    int poisonItems = 0;
+    int stage = 1;
+    bool completed = false;
+
+    bool operator==(const ReplayTotals& other) const {
+        return score == other.score && maxLength == other.maxLength && currentLength == other.currentLength &&
+               gatesUsed == other.gatesUsed && poisonItems == other.poisonItems &&
+               stage == other.stage && completed == other.completed;
+    }
+    bool operator!=(const ReplayTotals& other) const { return !(*this == other); }
+
+    static ReplayTotals fromSimulation(const Simulation& simulation);
+};
+
+// 게임 한 판의 리플레이: 시드 + 틱별 입력
+// 바이너리 형식 (정수는 LEB128 가변 길이):
+//   "SNKR" 버전(1) 너비 높이 시드(8바이트 LE)
+//   행동마다 varint((직전 기록 이후 틱 수 << 3) | 행동 코드 1~6)
+//   끝 표시 varint((남은 틱 수 << 3) | 0), 이어서 결과 varint 7개
+// 입력이 드문 게임은 1분(300틱)에 수십 바이트 수준
+class Replay {
+public:
+    Replay();
+    Replay(int width, int height, uint64_t seed);
+
+    // 기록
+    void recordAction(long long tick, GameAction action);  // NONE은 무시
+    void finish(const Simulation& simulation);             // 총 틱 수와 결과 저장
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    uint64_t getSeed() const { return seed; }
+    long long getTickCount() const { return tickCount; }
+    const std::vector<ReplayEvent>& getEvents() const { return events; }
+    const ReplayTotals& getTotals() const { return totals; }
+
+    // 직렬화
+    std::vector<uint8_t> encode() const;
+    bool decode(const std::vector<uint8_t>& bytes);  // 형식이 잘못되었으면 false
+    bool saveToFile(const std::string& filename) const;
+    bool loadFromFile(const std::string& filename);
+
+    static const uint8_t FORMAT_VERSION = 1;
+
+private:
+    int width;
+    int height;
+    uint64_t seed;
+    long long tickCount;
+    std::vector<ReplayEvent> events;
+    ReplayTotals totals;
+
+    static int actionCode(GameAction action);
+    static GameAction actionFromCode(int code);
+};
+
+#endif // REPLAY_HPP
@@ -0,0 +1,38 @@
+#ifndef REPLAY_PLAYER_HPP
+#define REPLAY_PLAYER_HPP
+
+#include "Replay.hpp"
+
+// 리플레이 재생 결과
+struct ReplayResult {
+    ReplayTotals totals;
+    long long ticks = 0;
+    bool matchesRecording = false;  // 기록된 결과와 완전히 같은지
+};
+
+// 리플레이를 헤드리스로 최대 속도 재생 (벽시계 대신 가상 틱으로 update 진행)
+class ReplayPlayer {
+public:
+    explicit ReplayPlayer(const Replay& replay);
+
+    // 다음 틱의 입력을 적용하고 한 틱 진행 (끝났으면 false)
+    bool step();
+
+    // 끝까지 재생
+    ReplayResult playToEnd();
+
+    const Simulation& getSimulation() const { return simulation; }
+    bool isFinished() const;
+
+    // 리플레이 하나를 처음부터 끝까지 재생
+    static ReplayResult play(const Replay& replay);
+
+private:
+    const Replay& replay;
+    Simulation simulation;
+    size_t nextEvent;
+
+    void applyEventsForCurrentTick();
+};
+
+#endif // REPLAY_PLAYER_HPP
@@ -0,0 +1,176 @@
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include "GameClock.hpp"
+#include "GameRng.hpp"
+#include "GameMap.hpp"
+#include "Snake.hpp"
+#include "ItemManager.hpp"
+#include "GateManager.hpp"
+#include "TemporaryWallManager.hpp"
+#include "ScoreManager.hpp"
+#include "StageManager.hpp"
+#include "StateStream.hpp"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// 입력 장치와 무관한 추상 행동
+enum class GameAction {
+    NONE,
+    TURN_UP,
+    TURN_DOWN,
+    TURN_LEFT,
+    TURN_RIGHT,
+    PLACE_WALL,  // 뱀 머리 주변에 Temporary Wall 생성
+    QUIT
+};
+
+// 게임 규칙 엔진 (ncurses 의존성 없음)
+class Simulation {
+public:
+    Simulation(int width, int height);                  // 무작위 시드
+    Simulation(int width, int height, uint64_t seed);   // 같은 시드 + 같은 입력이면 같은 게임
+    ~Simulation();
+
+    // 게임 상태
+    bool isGameOver() const { return gameOver; }
+    bool isGameCompleted() const { return gameCompleted; }
+    uint64_t getSeed() const { return seed; }
+
+    // 게임 객체 접근
+    GameClock& getClock() { return clock; }
+    const GameClock& getClock() const { return clock; }
+    Snake& getSnake() { return snake; }
+    const Snake& getSnake() const { return snake; }
+    GameMap& getMap() { return map; }
+    const GameMap& getMap() const { return map; }
+    ScoreManager& getScoreManager() { return scoreManager; }
+    const ScoreManager& getScoreManager() const { return scoreManager; }
+    ItemManager& getItemManager() { return itemManager; }
+    const ItemManager& getItemManager() const { return itemManager; }
+    GateManager& getGateManager() { return gateManager; }
+    const GateManager& getGateManager() const { return gateManager; }
+    TemporaryWallManager& getTemporaryWallManager() { return temporaryWallManager; }
+    const TemporaryWallManager& getTemporaryWallManager() const { return temporaryWallManager; }
+    StageManager& getStageManager() { return stageManager; }
+    const StageManager& getStageManager() const { return stageManager; }
+
+    // 속도 관리
+    int getCurrentTickDuration() const { return currentTickDuration; }
+    int getBaseTickDuration() const { return baseTickDuration; }
+    int getSpeedBoostCount() const { return speedBoostCount; }
+    void applySpeedBoost();
+    void resetSpeed();
+
+    // 게임 로직
+    void update();
+    void applyAction(GameAction action);
+    void updateMap();  // 변경된 셀만 다시 계산 (전체 변경 표시 시 전체 재구성)
+
+    // 같은 크기의 새 게임으로 되돌림 (Simulation(width, height, seed)와 같은 상태, 버퍼 재사용)
+    void reset(uint64_t seed);
+
+    // 틱을 단계별로 진행하는 호출자(VecSnakeEnv의 배열 경로)용
+    // - hasScheduledWork(): 다음 update()에서 아이템/Gate/Temporary Wall의 만료나 생성이 일어나는지
+    // - recordItemCollected(): 아이템 획득의 점수/미션/속도 처리 (뱀 길이 변화는 호출자 몫)
+    // - completeTick(): update()의 마지막 단계 (길이 기록, 스테이지 완료 확인, 맵 갱신)
+    bool hasScheduledWork() const;
+    void recordItemCollected(ItemType type);
+    void completeTick();
+
+    // 게임 전체 상태 스냅샷 (탐색 봇의 포크/되감기, 긴 게임의 일시 정지 후 재개용)
+    // 형식: "SNKS" 버전 너비 높이 검사합(8바이트) 본문
+    // 본문은 시계, 맵(셀 인덱스 슬롯 순서 포함), 뱀, 아이템/Gate/Temporary Wall과 만료 일정,
+    // 점수, 스테이지/미션 진행도, 모든 난수 스트림 상태, 속도와 자동 생성 타이머
+    void saveSnapshot(std::vector<uint8_t>& out) const;  // out을 덮어씀 (버퍼 재사용)
+    std::vector<uint8_t> saveSnapshot() const;
+    // 맵 크기가 다르거나 형식/검사합이 맞지 않거나 본문 값이 범위를 벗어나면 상태를 바꾸지 않고 false
+    // 복원 후 이어서 update()하면 스냅샷 시점부터 원래 게임과 같은 결과
+    bool restoreSnapshot(const std::vector<uint8_t>& bytes);
+
+    static const uint8_t SNAPSHOT_VERSION = 2;
+
+    // 트리 탐색용 포크: 이 게임과 같은 상태에서 독립적으로 진행하는 복제본
+    // 맵 셀/인덱스와 뱀 점유 카운터는 청크 단위로, 스테이지 데이터는 통째로 공유하고
+    // 어느 쪽이든 쓰는 순간 그 부분만 복제 (자식 비용 ≈ 실제로 바꾼 청크 수)
+    std::unique_ptr<Simulation> fork() const;
+
+    // 디버그: 증분 갱신 결과를 전체 재구성과 비교
+    void setMapVerification(bool enabled) { mapVerificationEnabled = enabled; }
+    bool isMapVerificationEnabled() const { return mapVerificationEnabled; }
+    int getMapMismatchCount() const { return mapMismatchCount; }  // 누적 불일치 셀 수
+
+    // Temporary Wall 관련
+    void createTemporaryWallAroundSnake();
+    void createRandomTemporaryWalls();
+
+    // 자동 생성 타이머 관련
+    GameClock::time_point getLastTemporaryWallCreation() const { return lastTemporaryWallCreation; }
+    void setLastTemporaryWallCreation(GameClock::time_point time) { lastTemporaryWallCreation = time; }
+    int getTemporaryWallCreationInterval() const { return temporaryWallCreationInterval.count(); }
+
+private:
+    // 포크 전용 복사 (매니저들을 복제본의 맵/시계에 다시 연결)
+    Simulation(const Simulation& other);
+    Simulation& operator=(const Simulation&) = delete;
+
+    GameClock clock;  // 매 update()마다 현재 틱 지속시간만큼 진행
+    GameMap map;
+    Snake snake;
+    ItemManager itemManager;
+    GateManager gateManager;
+    TemporaryWallManager temporaryWallManager;
+    ScoreManager scoreManager;
+    StageManager stageManager;
+    bool gameOver;
+    bool gameCompleted;
+    uint64_t seed;  // 게임 난수 시드 (모든 스트림의 뿌리)
+    GameRng rng;    // Temporary Wall 위치 선택용 스트림
+
+    // 속도 관리
+    static const int baseTickDuration = 200;  // 기본 틱 지속시간 (ms)
+    static const int minTickDuration = 50;    // 최소 틱 지속시간 (ms)
+    int currentTickDuration;                  // 현재 틱 지속시간 (ms)
+    int speedBoostCount;                      // 속도 부스트 횟수
+
+    // 자동 Temporary Wall 생성 관련
+    GameClock::time_point lastTemporaryWallCreation;
+    std::chrono::milliseconds temporaryWallCreationInterval;
+
+    // 맵 증분 갱신 검증
+    bool mapVerificationEnabled;
+    int mapMismatchCount;
+
+    // 스냅샷 본문 읽기 (restoreSnapshot이 포크한 복사본에서 호출, 끝까지 유효하면 true)
+    bool loadSnapshotBody(StateReader& reader);
+    // 스냅샷에 담기는 상태 교환 (매니저의 맵/시계 연결과 디버그 설정은 그대로)
+    void swapState(Simulation& other);
+
+    // 생성자와 reset()의 공통 마무리 (난수 스트림, 점수/스테이지 초기화, 첫 맵 반영)
+    void startGame();
+
+    // 충돌 감지
+    bool checkWallCollision() const;
+
+    // 맵 갱신
+    void rebuildMap();                       // 모든 레이어를 다시 찍는 전체 재구성
+    uint8_t resolveCell(int x, int y) const;  // 한 셀의 표시 값을 레이어 우선순위로 계산
+    void verifyMap();
+
+    // 아이템 관련
+    void handleItemCollision();
+
+    // Gate 관련
+    void handleGateCollision();
+
+    // 스테이지 관련
+    void checkStageCompletion();
+
+    // Temporary Wall 관련 (private)
+    void checkTemporaryWallCreation();
+    bool isTemporaryWallCandidate(int x, int y) const;  // 빈 칸이고 뱀과 충분히 떨어져 있는지
+};
+
+#endif // SIMULATION_HPP
@@ -0,0 +1,61 @@
+#ifndef STATE_STREAM_HPP
+#define STATE_STREAM_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// 게임 상태 직렬화용 바이트 스트림 (스냅샷/리플레이 공통)
+// 정수는 LEB128 가변 길이, 부호 있는 정수는 zigzag 변환 후 저장
+class StateWriter {
+public:
+    explicit StateWriter(std::vector<uint8_t>& out) : out(out) {}
+
+    void writeByte(uint8_t value) { out.push_back(value); }
+    void writeBytes(const uint8_t* data, size_t size) { out.insert(out.end(), data, data + size); }
+    void writeBool(bool value) { out.push_back(value ? 1 : 0); }
+    void writeVarint(uint64_t value);
+    void writeInt(int64_t value);      // zigzag + varint
+    void writeFixed64(uint64_t value); // 8바이트 LE (난수 상태처럼 고르게 퍼진 값용)
+
+    size_t size() const { return out.size(); }
+
+private:
+    std::vector<uint8_t>& out;
+};
+
+// 읽기 중 데이터가 모자라거나 값이 범위를 벗어나면 실패 상태가 되고,
+// 이후 읽기는 모두 0을 반환 (호출자는 마지막에 ok()만 확인하면 됨)
+class StateReader {
+public:
+    StateReader(const uint8_t* data, size_t size) : data(data), size(size), pos(0), failed(false) {}
+    explicit StateReader(const std::vector<uint8_t>& bytes) : StateReader(bytes.data(), bytes.size()) {}
+
+    uint8_t readByte();
+    bool readBytes(uint8_t* dest, size_t count);
+    bool skip(size_t count);          // current()로 직접 읽은 뒤 건너뛸 때
+    bool readBool() { return readByte() != 0; }
+    uint64_t readVarint();
+    int64_t readInt();
+    int readInt32();                  // int 범위를 벗어나면 실패
+    uint64_t readFixed64();
+    size_t readCount(size_t maxCount);  // 원소 개수 (maxCount 초과면 실패, 할당 폭주 방지)
+
+    void fail() { failed = true; }
+    bool ok() const { return !failed; }
+    bool atEnd() const { return pos == size; }
+    size_t position() const { return pos; }
+    size_t remaining() const { return size - pos; }
+    const uint8_t* current() const { return data + pos; }
+
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+    bool failed;
+};
+
+// 손상 검출용 FNV-1a 64비트 해시
+uint64_t stateChecksum(const uint8_t* data, size_t size);
+
+#endif // STATE_STREAM_HPP
@@ -0,0 +1,83 @@
+#ifndef TICK_PROFILER_HPP
+#define TICK_PROFILER_HPP
+
+#include "LatencyHistogram.hpp"
+#include <array>
+#include <chrono>
+#include <ostream>
+
+// 프로파일링 구간 (Simulation::update의 각 단계 + 그리기)
+enum class ProfilePhase {
+    SNAKE_MOVE,       // 뱀 이동
+    GATES,            // Gate 만료 및 생성
+    TEMPORARY_WALLS,  // Temporary Wall 만료 및 자동 생성
+    GATE_COLLISION,   // Gate 통과 처리
+    COLLISION,        // 벽/자기 충돌 감지
+    ITEMS,            // 아이템 만료, 생성, 충돌
+    SCORE_AND_STAGE,  // 점수 및 스테이지 확인
+    UPDATE_MAP,       // 맵 갱신
+    DRAW,             // 화면 그리기
+    COUNT
+};
+
+// 구간별 지연 시간 히스토그램 모음
+// 스레드마다 하나씩 존재 (current()) - 여러 Simulation을 병렬로 돌려도 잠금 불필요
+class TickProfiler {
+public:
+    static const int PHASE_COUNT = static_cast<int>(ProfilePhase::COUNT);
+
+    TickProfiler();
+
+    // 현재 스레드의 프로파일러
+    static TickProfiler& current();
+
+    void record(ProfilePhase phase, uint64_t nanoseconds) {
+        histograms[static_cast<int>(phase)].record(nanoseconds);
+    }
+    const LatencyHistogram& getHistogram(ProfilePhase phase) const {
+        return histograms[static_cast<int>(phase)];
+    }
+    void merge(const TickProfiler& other);
+    void reset();
+
+    // 구간별 횟수와 p50/p99/p999/최대값 (마이크로초) 표 출력
+    void writeReport(std::ostream& out) const;
+
+    static const char* getPhaseName(ProfilePhase phase);
+
+private:
+    std::array<LatencyHistogram, PHASE_COUNT> histograms;
+};
+
+// 스코프 동안의 경과 시간을 현재 스레드 프로파일러에 기록
+class ScopedPhaseTimer {
+public:
+    explicit ScopedPhaseTimer(ProfilePhase phase)
+        : phase(phase), start(std::chrono::steady_clock::now()) {
+    }
+    ~ScopedPhaseTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        TickProfiler::current().record(
+            phase, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+    ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+private:
+    ProfilePhase phase;
+    std::chrono::steady_clock::time_point start;
+};
+
+// SNAKE_ENABLE_PROFILING이 정의되지 않으면 계측 코드가 완전히 사라짐
+#define SNAKE_PROFILE_CONCAT_INNER(a, b) a##b
+#define SNAKE_PROFILE_CONCAT(a, b) SNAKE_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef SNAKE_ENABLE_PROFILING
+#define SNAKE_PROFILE_PHASE(phase) \
+    ScopedPhaseTimer SNAKE_PROFILE_CONCAT(snakeProfileTimer, __LINE__)(ProfilePhase::phase)
+#else
+#define SNAKE_PROFILE_PHASE(phase) ((void)0)
+#endif
+
+#endif // TICK_PROFILER_HPP
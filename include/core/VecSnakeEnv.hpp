@@ -0,0 +1,136 @@
+#ifndef VEC_SNAKE_ENV_HPP
+#define VEC_SNAKE_ENV_HPP
+
+#include "Simulation.hpp"
+#include "WorkStealingPool.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// 강화학습용 다중 환경 (모든 환경을 같은 박자로 한 틱씩 진행)
+// 매 틱 일어나는 일은 환경 인덱스로 색인한 연속 배열(SoA)에서 모든 환경을 한 루프로 처리:
+//   뱀 몸통 링/머리/방향/점유 카운터, 아이템 칸, 관측(= 맵 셀 값)으로
+//   이동 → 벽/자기 충돌 → 아이템 획득
+// 드문 일만 환경마다 가진 Simulation이 처리 (Game::update와 동일한 규칙):
+//   Gate 통과, 스테이지 전환, 아이템/Gate/Temporary Wall의 만료와 생성, PLACE_WALL/QUIT
+//   (그 틱 직전에 Simulation의 뱀을 배열에 맞추고, 진행 후 결과를 배열로 다시 가져옴)
+// 배열 경로도 Simulation::updateMap과 같은 순서로 맵 셀을 쓰므로 (빈 셀 인덱스 슬롯 순서 포함)
+// 단독 Simulation과 같은 시드/입력이면 같은 게임이 됨
+//   observations[env * width * height + y * width + x] = 맵 셀 값
+//   rewards[env], dones[env]
+// 끝난 환경은 step 안에서 다음 시드로 제자리 리셋 (관측은 새 에피소드의 첫 상태)
+class VecSnakeEnv {
+public:
+    // 보상 구성
+    static constexpr float REWARD_PER_LENGTH = 1.0f;   // 아이템으로 인한 길이 1 변화당 (Growth +, Poison -)
+    static constexpr float REWARD_PER_GATE = 0.5f;     // Gate 통과당
+    static constexpr float REWARD_STAGE_CLEAR = 10.0f; // 스테이지 클리어 (마지막 스테이지 포함)
+    static constexpr float REWARD_DEATH = -10.0f;      // 충돌로 게임 오버
+
+    VecSnakeEnv(int envCount, int width = 31, int height = 31, uint64_t baseSeed = 1, int threadCount = 1);
+    ~VecSnakeEnv();
+
+    // 모든 환경을 새 에피소드로 리셋하고 관측 갱신
+    void reset();
+
+    // actions[env]를 적용하고 한 틱 진행 - 관측/보상/종료 배열 갱신
+    void step(const GameAction* actions);
+    void step(const std::vector<GameAction>& actions) { step(actions.data()); }
+
+    int getEnvCount() const { return envCount; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getObservationSize() const { return width * height; }
+
+    const uint8_t* getObservations() const { return observations.data(); }
+    const uint8_t* getObservation(int env) const { return observations.data() + static_cast<size_t>(env) * getObservationSize(); }
+    const float* getRewards() const { return rewards.data(); }
+    const uint8_t* getDones() const { return dones.data(); }
+
+    // 에피소드 통계
+    long long getEpisodeCount(int env) const { return episodeCounts[env]; }  // 끝난 에피소드 수
+    float getEpisodeReturn(int env) const { return episodeReturns[env]; }    // 진행 중인 에피소드 누적 보상
+    float getLastEpisodeReturn(int env) const { return lastEpisodeReturns[env]; }
+
+    // 환경의 게임 상태 (뱀은 배열 경로가 진행한 상태로 맞춘 뒤 돌려줌)
+    const Simulation& getSimulation(int env);
+
+    // 지난 step에서 Simulation이 진행한 환경 수 (나머지는 배열 경로)
+    int getSimulationStepCount() const { return simulationStepCount; }
+
+    // 환경/에피소드별 시드
+    static uint64_t episodeSeed(uint64_t baseSeed, int env, long long episode);
+
+private:
+    // 환경별 이번 틱 진행 방식 (배열 루프에서 결정)
+    enum StepKind : uint8_t {
+        STEP_MOVE,        // 빈 칸으로 이동
+        STEP_ITEM,        // 아이템 칸으로 이동
+        STEP_DEATH,       // 벽/몸통 충돌 또는 최소 길이에서 Poison
+        STEP_SIMULATION   // Simulation::update로 진행
+    };
+
+    static constexpr int MAX_STEP_CELLS = 5;  // 한 틱에 배열 경로가 다시 쓰는 셀 수 상한
+
+    int envCount;
+    int width;
+    int height;
+    int cellCount;
+    uint64_t baseSeed;
+
+    std::vector<std::unique_ptr<Simulation>> simulations;
+    std::unique_ptr<WorkStealingPool> pool;  // threadCount > 1일 때만
+
+    // 환경 인덱스로 색인한 연속 배열
+    std::vector<uint8_t> observations;
+    std::vector<float> rewards;
+    std::vector<uint8_t> dones;
+    std::vector<int> lengthGains;   // 직전 틱 누적 Growth - Poison 수
+    std::vector<int> gatesUsed;     // 직전 틱 누적 Gate 사용 횟수
+    std::vector<int> stages;        // 직전 틱 스테이지 번호
+    std::vector<int> nextLengthGains;  // 이번 틱 결과 (보상 계산 전)
+    std::vector<int> nextGatesUsed;
+    std::vector<int> nextStages;
+    std::vector<uint8_t> completed;
+    std::vector<long long> episodeCounts;
+    std::vector<float> episodeReturns;
+    std::vector<float> lastEpisodeReturns;
+
+    // 뱀/아이템 상태 (배열 경로의 기준 데이터, 셀 = y * width + x)
+    // 링 버퍼는 환경마다 맵 셀 수 이상의 2의 거듭제곱 칸 (뱀은 맵보다 길어질 수 없으므로 확장 없음)
+    int bodyCapacity;
+    std::vector<int> bodyCells;      // bodyCells[env * bodyCapacity + ((bodyHeads[env] + i) & (bodyCapacity - 1))] = 머리부터 i번째 마디
+    std::vector<int> bodyHeads;
+    std::vector<int> bodyLengths;
+    std::vector<uint8_t> directions;  // Direction 값
+    std::vector<uint8_t> growing;     // 다음 이동에서 꼬리 유지 (Growth 직후)
+    std::vector<uint8_t> occupancy;   // occupancy[env * cellCount + cell] = 겹친 마디 수
+    std::vector<int> itemCells;       // itemCells[env * ItemManager::MAX_ITEMS + slot] (빈 슬롯 -1)
+    std::vector<uint8_t> itemValues;  // 아이템의 맵 값 (5, 6, 8)
+    std::vector<uint8_t> scheduled;   // 다음 틱에 예약된 일이 있어 Simulation이 진행해야 함
+    std::vector<uint8_t> snakeSynced; // Simulation의 뱀이 배열과 같은지
+
+    // 이번 틱 배열 루프 결과
+    std::vector<uint8_t> stepKinds;
+    std::vector<int> stepCells;       // stepCells[env * MAX_STEP_CELLS + i] = 다시 쓸 셀 (updateMap과 같은 순서)
+    std::vector<uint8_t> stepCellCounts;
+    std::vector<int> stepItemCells;   // STEP_ITEM이면 먹은 아이템 칸
+    int simulationStepCount;
+
+    // 워커별 뱀 동기화 버퍼 (마디 좌표)
+    std::vector<std::vector<Position>> segmentBuffers;
+
+    void resetEnv(int env);
+    void moveEnv(int env, GameAction action);                 // 배열 루프 한 칸: 이동/충돌/아이템 판정
+    void finishEnv(int env, GameAction action, int worker);   // 환경별 마무리 후 카운터 배열에 기록
+    void syncSnakeToSimulation(int env, int worker);
+    void loadFromSimulation(int env);  // Simulation의 뱀/아이템/맵을 배열로 가져옴
+    void writeStepCells(int env);
+    uint8_t resolveCell(int env, int cell) const;  // 배열 경로에서 다시 쓰는 셀의 값
+
+    size_t bodyIndex(int env, int i) const {
+        return static_cast<size_t>(env) * bodyCapacity + ((bodyHeads[env] + i) & (bodyCapacity - 1));
+    }
+};
+
+#endif // VEC_SNAKE_ENV_HPP
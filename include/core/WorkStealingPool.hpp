@@ -0,0 +1,61 @@
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 작업 훔치기 스레드 풀 (배치 시뮬레이션용)
+// parallelFor는 인덱스 구간을 워커마다 나눠 주고, 자기 구간을 다 쓴 워커는
+// 다른 워커 구간의 뒤쪽 절반을 훔쳐 감 - 게임마다 길이가 달라도 부하가 고르게 분산
+class WorkStealingPool {
+public:
+    using Task = std::function<void(size_t index, int worker)>;
+
+    explicit WorkStealingPool(int threadCount = 0);  // 0이면 하드웨어 스레드 수
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // [0, count)의 모든 인덱스에 대해 task를 실행하고 끝날 때까지 대기
+    // task가 던진 첫 번째 예외는 호출 스레드에서 다시 던짐
+    void parallelFor(size_t count, const Task& task);
+
+    int getThreadCount() const { return static_cast<int>(workers.size()); }
+    long long getStealCount() const { return stealCount.load(); }
+
+private:
+    // 워커가 소유한 남은 인덱스 구간 [begin, end)
+    struct Range {
+        std::mutex mutex;
+        size_t begin = 0;
+        size_t end = 0;
+    };
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<Range>> ranges;
+
+    std::mutex jobMutex;
+    std::condition_variable jobStarted;
+    std::condition_variable jobFinished;
+    const Task* currentTask;
+    unsigned long long jobGeneration;
+    int idleWorkers;
+    bool stopping;
+    std::exception_ptr firstError;
+
+    std::atomic<long long> stealCount;
+
+    void workerLoop(int worker);
+    bool takeOwn(int worker, size_t& index);
+    bool steal(int worker);
+};
+
+#endif // WORK_STEALING_POOL_HPP
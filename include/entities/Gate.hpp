@@ -2,6 +2,7 @@
 #define GATE_HPP
 
 #include "Snake.hpp"  // Position 구조체 사용
+#include "GameClock.hpp"
 #include <chrono>
 
 enum class GateType {
@@ -16,7 +17,8 @@ enum class WallType {
 
 class Gate {
 public:
-    Gate(int x, int y, GateType type, WallType wallType, int pairId = 0, int originalWallValue = 1);
+    Gate(int x, int y, GateType type, WallType wallType, int pairId = 0, int originalWallValue = 1,
+         GameClock::time_point creationTime = GameClock::time_point());
     ~Gate();
 
     // 위치 관련
@@ -40,8 +42,9 @@ public:
     int getOriginalWallValue() const { return originalWallValue; }
 
     // 시간 관련
-    std::chrono::steady_clock::time_point getCreationTime() const { return creationTime; }
-    bool isExpired() const;
+    GameClock::time_point getCreationTime() const { return creationTime; }
+    bool isExpired(GameClock::time_point now) const;
+    GameClock::time_point getExpiryTime() const { return creationTime + std::chrono::seconds(GATE_DURATION_SECONDS); }
     static constexpr int GATE_DURATION_SECONDS = 10;
 
 private:
@@ -50,7 +53,7 @@ private:
     WallType wallType;
     int pairId;  // 게이트 쌍 식별자
     int originalWallValue;  // 원래 벽 값 (1: Wall, 2: Immune Wall)
-    std::chrono::steady_clock::time_point creationTime;
+    GameClock::time_point creationTime;
 };
 
 #endif // GATE_HPP 
\ No newline at end of file
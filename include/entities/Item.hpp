@@ -1,6 +1,7 @@
 #ifndef ITEM_HPP
 #define ITEM_HPP
 
+#include "GameClock.hpp"
 #include <chrono>
 
 // Position 구조체는 Snake.hpp에서 가져옴
@@ -18,13 +19,14 @@ class Item {
 private:
     int x, y;  // 아이템 위치
     ItemType type;  // 아이템 타입
-    std::chrono::steady_clock::time_point creationTime;  // 생성 시간
+    GameClock::time_point creationTime;  // 생성 시간 (게임 시계 기준)
     std::chrono::milliseconds duration;  // 지속 시간
 
 public:
     // 생성자 (기본 지속시간 5초)
     Item(int x, int y, ItemType type, 
-         std::chrono::milliseconds duration = std::chrono::seconds(5));
+         std::chrono::milliseconds duration = std::chrono::seconds(5),
+         GameClock::time_point creationTime = GameClock::time_point());
     
     // 위치 관련 메서드
     int getX() const;
@@ -35,8 +37,10 @@ public:
     ItemType getType() const;
     
     // 만료 관련 메서드
-    bool isExpired() const;
-    std::chrono::milliseconds getRemainingTime() const;
+    GameClock::time_point getCreationTime() const;
+    bool isExpired(GameClock::time_point now) const;
+    GameClock::time_point getExpiryTime() const { return creationTime + duration; }
+    std::chrono::milliseconds getRemainingTime(GameClock::time_point now) const;
 };
 
 #endif // ITEM_HPP 
\ No newline at end of file
@@ -0,0 +1,19 @@
+#ifndef POSITION_HPP
+#define POSITION_HPP
+
+struct Position {
+    int x, y;
+    Position(int x = 0, int y = 0) : x(x), y(y) {}
+    bool operator==(const Position& other) const {
+        return x == other.x && y == other.y;
+    }
+    bool operator!=(const Position& other) const {
+        return !(*this == other);
+    }
+    bool operator<(const Position& other) const {
+        if (x != other.x) return x < other.x;
+        return y < other.y;
+    }
+};
+
+#endif // POSITION_HPP
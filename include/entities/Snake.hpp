@@ -1,7 +1,13 @@
 #ifndef SNAKE_HPP
 #define SNAKE_HPP
 
+#include "Position.hpp"
+#include "SnakeBody.hpp"
+#include "CowArray.hpp"
+#include "StateStream.hpp"
 #include <vector>
+#include <cstdint>
+#include <cstddef>
 
 enum class Direction {
     UP,
@@ -10,21 +16,6 @@ enum class Direction {
     RIGHT
 };
 
-struct Position {
-    int x, y;
-    Position(int x = 0, int y = 0) : x(x), y(y) {}
-    bool operator==(const Position& other) const {
-        return x == other.x && y == other.y;
-    }
-    bool operator!=(const Position& other) const {
-        return !(*this == other);
-    }
-    bool operator<(const Position& other) const {
-        if (x != other.x) return x < other.x;
-        return y < other.y;
-    }
-};
-
 class Snake {
 public:
     Snake(int startX, int startY);
@@ -38,11 +29,12 @@ public:
     // 위치 관련
     int getHeadX() const { return body[0].x; }
     int getHeadY() const { return body[0].y; }
-    const std::vector<Position>& getBody() const { return body; }
+    const SnakeBody& getBody() const { return body; }  // 머리부터 꼬리 순서
 
     // 크기 관련
     int getLength() const { return body.size(); }
     void grow();
+    bool isGrowing() const { return shouldGrow; }  // 다음 이동에서 꼬리를 유지하는지
     
     // 아이템 효과 적용
     void applyGrowthItem();
@@ -52,6 +44,20 @@ public:
 
     // 충돌 감지
     bool checkSelfCollision() const;
+
+    // 셀 점유 조회 (O(1), 해당 셀에 겹친 몸통 마디 수)
+    int getOccupancy(int x, int y) const {
+        int gx = x - occupancyOriginX;
+        int gy = y - occupancyOriginY;
+        if (gx < 0 || gx >= occupancyWidth || gy < 0 || gy >= occupancyHeight) return 0;
+        return occupancy[gy * occupancyWidth + gx];
+    }
+    bool isOccupied(int x, int y) const { return getOccupancy(x, y) > 0; }
+    bool isOccupied(const Position& pos) const { return isOccupied(pos.x, pos.y); }
+
+    // 마지막 clearChangedCells() 이후 맵 표시가 바뀌었을 수 있는 셀들
+    const std::vector<Position>& getChangedCells() const { return changedCells; }
+    void clearChangedCells() { changedCells.clear(); }
     
     // Gate 이동
     void teleportTo(const Position& newPosition);
@@ -59,12 +65,35 @@ public:
     // 리셋
     void reset(int startX, int startY);
 
+    // 다른 곳에서 진행한 몸통(머리부터 꼬리 순서)으로 교체 (맵에는 이미 반영되었다고 보고 변경 기록은 비움)
+    void assignBody(const Position* segments, size_t length, Direction newDirection, bool growing);
+
+    // 스냅샷 저장/복원 (점유 카운터는 몸통에서 다시 계산)
+    // 마디/변경 셀 좌표가 mapWidth x mapHeight 밖이면 몸통을 바꾸지 않고 실패
+    void saveState(StateWriter& out) const;
+    bool loadState(StateReader& in, int mapWidth, int mapHeight);
+
 private:
-    std::vector<Position> body;
+    SnakeBody body;  // 링 버퍼 (머리 추가/꼬리 제거 O(1))
     Direction direction;
     bool shouldGrow;
 
+    // 셀별 점유 카운터 (몸통 변경 시 증분 갱신, 필요하면 범위 확장, 포크 시 청크 공유)
+    CowArray<uint16_t> occupancy;
+    int occupancyOriginX;
+    int occupancyOriginY;
+    int occupancyWidth;
+    int occupancyHeight;
+
+    // 변경된 셀 기록 (증분 맵 갱신용)
+    std::vector<Position> changedCells;
+
     bool isOppositeDirection(Direction newDir) const;
+
+    // 점유 카운터 증감
+    void addOccupancy(const Position& pos);
+    void removeOccupancy(const Position& pos);
+    void expandOccupancyToCover(const Position& pos);
 };
 
 #endif // SNAKE_HPP 
\ No newline at end of file
@@ -0,0 +1,70 @@
+#ifndef SNAKE_BODY_HPP
+#define SNAKE_BODY_HPP
+
+#include "Position.hpp"
+#include <vector>
+#include <cstddef>
+#include <iterator>
+
+// 뱀 몸통용 링 버퍼 (머리 추가/꼬리 제거가 O(1))
+// 인덱스 0이 머리, size()-1이 꼬리이며 순회 순서도 머리부터 꼬리까지
+class SnakeBody {
+public:
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Position;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Position*;
+        using reference = const Position&;
+
+        const_iterator(const SnakeBody* body, size_t index) : body(body), index(index) {}
+
+        reference operator*() const { return (*body)[index]; }
+        pointer operator->() const { return &(*body)[index]; }
+        const_iterator& operator++() { ++index; return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++index; return tmp; }
+        bool operator==(const const_iterator& other) const { return index == other.index && body == other.body; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+        const SnakeBody* body;
+        size_t index;
+    };
+
+    explicit SnakeBody(size_t initialCapacity = 16);
+
+    // 머리 기준 인덱스 접근
+    const Position& operator[](size_t i) const { return buffer[(headIndex + i) & mask]; }
+    Position& operator[](size_t i) { return buffer[(headIndex + i) & mask]; }
+    const Position& front() const { return (*this)[0]; }
+    Position& front() { return (*this)[0]; }
+    const Position& back() const { return (*this)[count - 1]; }
+    Position& back() { return (*this)[count - 1]; }
+
+    // 크기 관련
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_t capacity() const { return buffer.size(); }
+
+    // 머리 추가 / 꼬리 추가 / 꼬리 제거
+    void push_front(const Position& position);
+    void push_back(const Position& position);
+    void pop_back();
+    void clear();
+
+    // 머리부터 꼬리까지 순회
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, count); }
+
+private:
+    std::vector<Position> buffer;  // 용량은 항상 2의 거듭제곱
+    size_t headIndex;              // 머리가 저장된 버퍼 위치
+    size_t count;
+    size_t mask;
+
+    // 버퍼가 가득 찼을 때 용량을 두 배로 늘림 (머리를 0번으로 재배치)
+    void expand();
+};
+
+#endif // SNAKE_BODY_HPP
@@ -2,11 +2,13 @@
 #define TEMPORARY_WALL_HPP
 
 #include "Snake.hpp"  // Position 구조체 사용
+#include "GameClock.hpp"
 #include <chrono>
 
 class TemporaryWall {
 public:
-    TemporaryWall(Position position, std::chrono::milliseconds lifetime);
+    TemporaryWall(Position position, std::chrono::milliseconds lifetime,
+                  GameClock::time_point creationTime = GameClock::time_point());
     ~TemporaryWall();
 
     // 위치 관련
@@ -15,13 +17,14 @@ public:
     int getY() const { return position.y; }
 
     // 시간 관련
-    std::chrono::steady_clock::time_point getCreationTime() const { return creationTime; }
-    bool isExpired() const;
+    GameClock::time_point getCreationTime() const { return creationTime; }
+    bool isExpired(GameClock::time_point now) const;
+    GameClock::time_point getExpiryTime() const { return creationTime + lifetime; }
     std::chrono::milliseconds getLifetime() const { return lifetime; }
 
 private:
     Position position;
-    std::chrono::steady_clock::time_point creationTime;
+    GameClock::time_point creationTime;
     std::chrono::milliseconds lifetime;
 };
 
@@ -13,6 +13,10 @@ public:
     // 생성자
     MissionManager();
 
+    // 복사 (미션 진행도까지 복제, 포크한 게임의 스테이지 분리용)
+    MissionManager(const MissionManager& other);
+    MissionManager& operator=(const MissionManager& other);
+
     // 미션 관리
     void addMission(MissionType type, int targetValue, const std::string& description);
     void clearAllMissions();
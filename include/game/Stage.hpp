@@ -2,6 +2,7 @@
 #define STAGE_HPP
 
 #include "MissionManager.hpp"
+#include <memory>
 #include <string>
 #include <vector>
 #include <utility>
@@ -12,7 +13,8 @@ class Stage {
 private:
     int stageNumber;
     std::string stageName;
-    std::vector<std::pair<int, int>> wallLayout;
+    // 바뀌지 않는 벽 레이아웃 (Stage를 복사해도 공유)
+    std::shared_ptr<const std::vector<std::pair<int, int>>> wallLayout;
     MissionManager missionManager;
 
 public:
@@ -2,17 +2,20 @@
 #define STAGEMANAGER_HPP
 
 #include "Stage.hpp"
+#include "StateStream.hpp"
 #include <vector>
 #include <memory>
 
 class GameMap;
 
+// 복사하면 스테이지를 공유하고, 미션 진행도를 바꾸는 스테이지만 복제 (copy-on-write)
 class StageManager {
 private:
-    std::vector<std::unique_ptr<Stage>> stages;
+    std::vector<std::shared_ptr<Stage>> stages;
     int currentStageIndex;
 
     void initializeStages();
+    Stage& mutableStage(int index);  // 다른 StageManager와 공유 중이면 먼저 복제
 
 public:
     // 생성자
@@ -36,6 +39,10 @@ public:
     void updateMissionProgress(MissionType type, int currentValue);
     bool isCurrentStageCompleted() const;
     bool isGameCompleted() const;
+
+    // 스냅샷 저장/복원 (현재 스테이지와 모든 스테이지의 미션 진행도)
+    void saveState(StateWriter& out) const;
+    bool loadState(StateReader& in);
 };
 
 #endif // STAGEMANAGER_HPP 
\ No newline at end of file
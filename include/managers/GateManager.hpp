@@ -4,14 +4,32 @@
 #include "Gate.hpp"
 #include "GameMap.hpp"
 #include "Snake.hpp"
+#include "GameClock.hpp"
+#include "ExpiryScheduler.hpp"
+#include "GameRng.hpp"
+#include <array>
 #include <vector>
 #include <optional>
-#include <random>
 #include <map>
 
+// Gate 순간이동 간선: from 칸에서 entryDirection으로 gate에 들어가면 같은 틱에
+// exits 중 처음으로 비어 있는(값 0) 칸으로 나옴 (Simulation::handleGateCollision과 같은 규칙)
+// 방향 규칙은 Gate 쌍이 생길 때 한 번만 계산하고, 이동할 때는 후보 칸만 확인
+struct TeleportEdge {
+    Position from;             // 진입 직전 칸
+    Position gate;             // 들어가는 Gate
+    Direction entryDirection;  // 진입 방향 (순간이동 후에도 뱀 방향은 그대로)
+    int pairId;
+    std::array<Position, 4> exits;  // 우선순위 순 출구 후보
+    int exitCount;
+};
+
 class GateManager {
 public:
-    GateManager(GameMap& map);
+    // stream: 위치 선택용 난수 스트림 (기본값은 고정 시드, Simulation은 게임 시작 때 게임 시드에서 갈라진 스트림으로 교체)
+    GateManager(GameMap& map, const GameClock& clock, const GameRng& stream = GameRng());
+    // 포크용: other의 상태를 복사하고 새 맵/시계에 연결
+    GateManager(const GateManager& other, GameMap& map, const GameClock& clock);
     ~GateManager();
 
     // Gate 관리
@@ -19,10 +37,23 @@ public:
     void removeExpiredGates();
     void restoreGatePositionsToWalls();  // 게이트 위치를 원래 벽으로 복원
     void updateMap();
+    void clear();  // 모든 Gate와 만료 일정, 진입 상태 제거 (맵은 건드리지 않음)
+    void swapState(GateManager& other);  // Gate/만료 일정/난수/진입 상태 교환 (맵/시계 연결은 그대로)
+
+    // time까지 진행했을 때 만료되거나 새로 생길 Gate가 있는지
+    bool hasPendingWork(GameClock::time_point time) const {
+        return gates.size() < MAX_GATES * 2 || expiryScheduler.hasDue(time);
+    }
     
     // Gate 정보
     int getGateCount() const { return gates.size(); }
     const std::vector<Gate>& getGates() const { return gates; }
+    bool hasGateAt(int x, int y) const;
+
+    // 살아 있는 Gate 쌍의 순간이동 간선 (Gate 하나당 진입 직전 칸이 맵 안에 있는 방향마다 하나)
+    const std::vector<TeleportEdge>& getTeleportEdges() const { return teleportEdges; }
+    // 지금 맵에서 간선을 지나면 나오는 칸 (후보가 모두 막혀 있으면 없음)
+    std::optional<Position> resolveTeleportExit(const TeleportEdge& edge) const;
     
     // 충돌 감지
     std::optional<Gate> checkCollision(const Snake& snake);
@@ -46,25 +77,39 @@ public:
     // 테스트용 public 함수
     bool isSameOuterWall(const Position& pos1, const Position& pos2);
     
+    // 게임 난수 스트림 지정 (재현 가능한 게임용)
+    void setRandomStream(const GameRng& stream) { rng = stream; }
+
+    // 스냅샷 저장/복원 (Gate 쌍과 원래 벽 값, 진입 상태, 만료 일정, 난수 상태)
+    void saveState(StateWriter& out) const;
+    bool loadState(StateReader& in);
+
     static constexpr int MAX_GATES = 1;  // 최대 Gate 수 (입구/출구 쌍)
 
 private:
     GameMap& map;
+    const GameClock& clock;
     std::vector<Gate> gates;
-    std::random_device rd;
-    std::mt19937 rng;
-    std::uniform_int_distribution<int> dist;
+    ExpiryScheduler expiryScheduler;  // Gate 만료 시각 (키: 셀 인덱스)
+    std::vector<int> dueKeys;  // 만료 처리용 버퍼
+    GameRng rng;  // 게임 난수 스트림
     int nextPairId;  // 다음 게이트 쌍 ID
+    std::vector<TeleportEdge> teleportEdges;
     
     // Snake 진입 상태 추적
     std::map<Position, bool> snakeEnteringStates;
     
     // Gate 생성 헬퍼 메서드
-    std::vector<Position> findWallPositions(const Snake& snake);
+    std::optional<Position> drawWallPosition(std::optional<WallSide> excludedSide,
+                                             const Position& excludedPos, const Snake& snake);
     WallType determineWallType(int x, int y);
     bool isValidGatePosition(int x, int y, const Snake& snake);
     Position findValidExitPosition(const Position& entrance, Direction preferredDirection, const Snake& snake);
     std::vector<Direction> getDirectionPriority(const Position& gatePos, Direction snakeDirection);
+
+    // Gate 쌍이 생기거나 복원될 때 간선 추가, Gate가 사라지면 그 쌍의 간선 제거
+    void addTeleportEdges(int pairId);
+    void removeTeleportEdges(int pairId);
 };
 
 #endif // GATE_MANAGER_HPP 
\ No newline at end of file
@@ -4,8 +4,10 @@
 #include "Item.hpp"
 #include "GameMap.hpp"
 #include "Snake.hpp"
+#include "GameClock.hpp"
+#include "ExpiryScheduler.hpp"
+#include "GameRng.hpp"
 #include <vector>
-#include <random>
 #include <optional>
 #include <chrono>
 #include <thread>
@@ -13,15 +15,23 @@
 class ItemManager {
 private:
     GameMap& gameMap;  // 게임 맵 참조
+    const GameClock& clock;  // 게임 시계 참조
     std::vector<Item> items;  // 현재 활성 아이템들
-    std::random_device rd;  // 랜덤 시드
-    std::mt19937 gen;  // 랜덤 엔진
-    
-    static const int MAX_ITEMS = 3;  // 최대 아이템 수
+    ExpiryScheduler expiryScheduler;  // 아이템 만료 시각 (키: 셀 인덱스)
+    std::vector<int> dueKeys;  // 만료 처리용 버퍼
+    GameRng rng;  // 게임 난수 스트림
+
+    // 아이템 타입별 맵 값 (Growth 5, Poison 6, Speed 8)
+    static int getCellValueForType(ItemType type);
 
 public:
-    // 생성자
-    explicit ItemManager(GameMap& gameMap);
+    static const int MAX_ITEMS = 3;  // 최대 아이템 수
+
+    // 생성자 (stream: 위치 선택용 난수 스트림, 기본값은 고정 시드)
+    // Simulation은 게임을 시작할 때 게임 시드에서 갈라진 스트림으로 바꾸므로 random_device를 읽지 않음
+    ItemManager(GameMap& gameMap, const GameClock& clock, const GameRng& stream = GameRng());
+    // 포크용: other의 상태를 복사하고 새 맵/시계에 연결
+    ItemManager(const ItemManager& other, GameMap& gameMap, const GameClock& clock);
     
     // 아이템 관리 메서드
     void generateItems(const Snake& snake);  // 아이템 생성
@@ -29,9 +39,17 @@ public:
                  std::chrono::milliseconds duration = std::chrono::seconds(5));
     void removeExpiredItems();  // 만료된 아이템 제거
     void updateMap();  // 맵에 아이템 위치 업데이트
+    void clear();  // 모든 아이템과 만료 일정 제거 (맵은 건드리지 않음)
+    void swapState(ItemManager& other);  // 아이템/만료 일정/난수 상태 교환 (맵/시계 연결은 그대로)
+
+    // time까지 진행했을 때 만료되거나 새로 생길 아이템이 있는지
+    bool hasPendingWork(GameClock::time_point time) const {
+        return items.size() < MAX_ITEMS || expiryScheduler.hasDue(time);
+    }
     
     // 충돌 감지
     std::optional<Item> checkCollision(const Snake& snake);
+    std::optional<Item> takeItemAt(const Position& pos);  // 해당 칸의 아이템을 꺼냄 (없으면 없음)
     
     // 위치 관련 메서드
     std::optional<Position> findEmptyPosition(const Snake& snake);
@@ -40,9 +58,17 @@ public:
     // 정보 조회 메서드
     int getItemCount() const;
     const std::vector<Item>& getItems() const;
+    int getCellValueAt(int x, int y) const;  // 해당 위치 아이템의 맵 값 (없으면 0)
     
     // 랜덤 타입 생성
     ItemType getRandomItemType();
+
+    // 게임 난수 스트림 지정 (재현 가능한 게임용)
+    void setRandomStream(const GameRng& stream) { rng = stream; }
+
+    // 스냅샷 저장/복원 (아이템, 만료 일정, 난수 상태)
+    void saveState(StateWriter& out) const;
+    bool loadState(StateReader& in);
 };
 
 #endif // ITEMMANAGER_HPP 
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define SCOREMANAGER_HPP
 
 #include <string>
+#include "GameClock.hpp"
+#include "StateStream.hpp"
 #include <chrono>
 
 class ScoreManager {
@@ -9,9 +11,12 @@ private:
     int currentLength;
     int maxLength;
     int growthItemsCollected;
+    int totalGrowthItemsCollected;  // 스테이지 전환 시에도 초기화하지 않는 누적 Growth Item 수
     int poisonItemsCollected;
     int gatesUsed;
-    std::chrono::steady_clock::time_point gameStartTime;
+    int totalGatesUsed;  // 스테이지 전환 시에도 초기화하지 않는 누적 Gate 사용 횟수
+    GameClock::time_point gameStartTime;
+    GameClock::time_point currentTime;  // 마지막으로 전달받은 게임 시간
 
 public:
     // 생성자
@@ -27,12 +32,15 @@ public:
     void incrementPoisonItems();
     void incrementGatesUsed();
     int getGrowthItemsCollected() const;
+    int getTotalGrowthItemsCollected() const;
     int getPoisonItemsCollected() const;
     int getGatesUsed() const;
+    int getTotalGatesUsed() const;
 
     // 생존시간 관련
-    void setGameStartTime();
-    void setGameStartTime(const std::chrono::steady_clock::time_point& startTime);
+    void setGameStartTime();  // 현재 게임 시간을 시작 시간으로 설정
+    void setGameStartTime(const GameClock::time_point& startTime);
+    void updateGameTime(const GameClock::time_point& now);  // 틱마다 게임 시계 반영
     int getSurvivalTimeSeconds() const;
     std::string getFormattedSurvivalTime() const;
 
@@ -44,6 +52,10 @@ public:
     void saveToFile(const std::string& filename) const;
     void loadFromFile(const std::string& filename);
 
+    // 스냅샷 저장/복원 (모든 카운터와 게임 시간)
+    void saveState(StateWriter& out) const;
+    bool loadState(StateReader& in);
+
     // 초기화
     void reset();
     
@@ -3,12 +3,16 @@
 
 #include "TemporaryWall.hpp"
 #include "GameMap.hpp"
+#include "GameClock.hpp"
+#include "ExpiryScheduler.hpp"
 #include <vector>
 #include <chrono>
 
 class TemporaryWallManager {
 public:
-    TemporaryWallManager(GameMap& map);
+    TemporaryWallManager(GameMap& map, const GameClock& clock);
+    // 포크용: other의 상태를 복사하고 새 맵/시계에 연결
+    TemporaryWallManager(const TemporaryWallManager& other, GameMap& map, const GameClock& clock);
     ~TemporaryWallManager();
 
     // Temporary Wall 관리
@@ -16,15 +20,26 @@ public:
     void update();  // 만료된 벽들을 제거
     void updateMap();  // GameMap에 현재 임시 벽들을 반영
     void clear();  // 모든 임시 벽 제거
+    void swapState(TemporaryWallManager& other);  // 벽/만료 일정 교환 (맵/시계 연결은 그대로)
+
+    // time까지 진행했을 때 만료될 벽이 있는지
+    bool hasPendingWork(GameClock::time_point time) const { return expiryScheduler.hasDue(time); }
 
     // Temporary Wall 정보
     int getTemporaryWallCount() const { return temporaryWalls.size(); }
     bool hasTemporaryWallAt(Position pos) const;
     const std::vector<TemporaryWall>& getTemporaryWalls() const { return temporaryWalls; }
 
+    // 스냅샷 저장/복원 (남은 수명은 생성 시각과 수명으로 보존)
+    void saveState(StateWriter& out) const;
+    bool loadState(StateReader& in);
+
 private:
     GameMap& gameMap;
+    const GameClock& clock;
     std::vector<TemporaryWall> temporaryWalls;
+    ExpiryScheduler expiryScheduler;  // 벽 만료 시각 (키: 셀 인덱스)
+    std::vector<int> dueKeys;  // 만료 처리용 버퍼
     
     // 헬퍼 메서드
     void removeExpiredWalls();
@@ -1,4 +1,5 @@
 #include "GameMap.hpp"
+#include "MapRenderer.hpp"
 #include "ColorManager.hpp"
 #include <ncurses.h>
 #include <memory>
@@ -17,7 +18,8 @@ int main() {
 
     // 맵 생성
     GameMap map(21, 21);
-    map.setColorManager(colorManager);
+    MapRenderer renderer;
+    renderer.setColorManager(colorManager);
 
     // 테스트용 벽 추가
     map.setWall(5, 5);
@@ -30,7 +32,8 @@ int main() {
     map.setSnakeBody(10, 12);
 
     // 맵 그리기
-    map.draw();
+    renderer.draw(map);
+    refresh();
 
     // 아무 키나 누를 때까지 대기
     getch();
@@ -0,0 +1,29 @@
+#include "BatchRunner.hpp"
+#include "AutopilotPolicy.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+// 사용법: snake_batch [games] [threads] [seed] [random|safe|autopilot]
+int main(int argc, char* argv[]) {
+    BatchConfig config;
+    config.gameCount = argc > 1 ? std::atoi(argv[1]) : 1000;
+    config.threadCount = argc > 2 ? std::atoi(argv[2]) : 0;
+    config.baseSeed = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 1;
+    const char* policyName = argc > 4 ? argv[4] : "safe";
+
+    BatchRunner runner(config, [policyName](uint64_t seed) -> std::unique_ptr<InputPolicy> {
+        if (std::strcmp(policyName, "random") == 0) {
+            return std::make_unique<RandomTurnPolicy>(seed);
+        }
+        if (std::strcmp(policyName, "autopilot") == 0) {
+            return std::make_unique<AutopilotPolicy>();
+        }
+        return std::make_unique<SafeMovePolicy>(seed);
+    });
+    runner.run();
+
+    BatchRunner::writeSummary(std::cout, runner.getSummary());
+    return 0;
+}
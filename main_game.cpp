@@ -1,7 +1,61 @@
 #include "Game.hpp"
+#include "AutopilotPolicy.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
 
-int main() {
-    Game game(31, 31);
+// 사용법: snake_game_v2 [--size 맵크기] [--autopilot] [--record 리플레이파일 | --resume 일시정지파일]
+// 게임 중 's' 키를 누르면 일시 정지 파일(--resume으로 연 파일 또는 기본 파일)에 저장하고 종료
+// --autopilot이면 AutopilotPolicy가 매 틱 방향을 고름 (방향키로 끼어들 수 있음)
+// --size는 정사각형 맵의 한 변 (기본 31, 터미널보다 크면 뱀 머리 주변만 보여줌)
+// --resume은 저장할 때와 같은 --size가 필요, --record와 함께 쓸 수 없음
+//   (리플레이는 시드부터 재생하므로 중간부터 이어 한 게임은 기록할 수 없음)
+int main(int argc, char* argv[]) {
+    int size = 31;
+    bool record = false;
+    bool resume = false;
+    for (int i = 1; i + 1 < argc; i++) {
+        std::string option = argv[i];
+        if (option == "--size") {
+            size = std::atoi(argv[i + 1]);
+        } else if (option == "--record") {
+            record = true;
+        } else if (option == "--resume") {
+            resume = true;
+        }
+    }
+    if (record && resume) {
+        std::cerr << "--record cannot be combined with --resume" << std::endl;
+        return 1;
+    }
+    if (size < GameMap::MIN_SIZE || size > GameMap::MAX_SIZE) {
+        std::cerr << "map size must be between " << GameMap::MIN_SIZE << " and " << GameMap::MAX_SIZE << std::endl;
+        return 1;
+    }
+
+    Game game(size, size);
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (option == "--size" && i + 1 < argc) {
+            i++;  // 위에서 처리
+        } else if (option == "--autopilot") {
+            game.setAutopilot(std::make_unique<AutopilotPolicy>());
+        } else if (option == "--record" && i + 1 < argc) {
+            const char* filename = argv[++i];
+            if (!game.recordReplayTo(filename)) {
+                std::cerr << "cannot record to " << filename << std::endl;
+                return 1;
+            }
+        } else if (option == "--resume" && i + 1 < argc) {
+            const char* filename = argv[++i];
+            if (!game.loadSnapshotFromFile(filename)) {
+                std::cerr << "cannot resume from " << filename << std::endl;
+                return 1;
+            }
+            game.setSuspendFile(filename);
+        }
+    }
     game.run();
     return 0;
-} 
\ No newline at end of file
+}
@@ -0,0 +1,30 @@
+#include "ReplayPlayer.hpp"
+#include <cstdio>
+
+// 사용법: snake_replay 리플레이파일...
+// 각 리플레이를 헤드리스로 재생하고 기록된 ScoreManager 결과와 비교
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s replay...\n", argv[0]);
+        return 2;
+    }
+
+    int mismatches = 0;
+    for (int i = 1; i < argc; i++) {
+        Replay replay;
+        if (!replay.loadFromFile(argv[i])) {
+            std::printf("%s: unreadable\n", argv[i]);
+            mismatches++;
+            continue;
+        }
+
+        ReplayResult result = ReplayPlayer::play(replay);
+        std::printf("%s: %s ticks=%lld score=%d max_length=%d gates=%d stage=%d\n",
+                    argv[i], result.matchesRecording ? "OK" : "MISMATCH", result.ticks,
+                    result.totals.score, result.totals.maxLength, result.totals.gatesUsed, result.totals.stage);
+        if (!result.matchesRecording) {
+            mismatches++;
+        }
+    }
+    return mismatches == 0 ? 0 : 1;
+}
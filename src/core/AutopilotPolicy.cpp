@@ -0,0 +1,243 @@
+#include "AutopilotPolicy.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+// 방향 인덱스는 Direction 열거 순서 (UP, DOWN, LEFT, RIGHT), 반대 방향은 index ^ 1
+const int DX[] = {0, 0, -1, 1};
+const int DY[] = {-1, 1, 0, 0};
+const uint8_t NO_DIRECTION = 4;
+
+const GameAction TURN_ACTIONS[] = {GameAction::TURN_UP, GameAction::TURN_DOWN,
+                                   GameAction::TURN_LEFT, GameAction::TURN_RIGHT};
+
+// 최소 f 우선, 같으면 더 깊은 노드 우선 (동점 칸을 덜 확장함)
+bool lowerPriority(int fa, int ga, int fb, int gb) {
+    return fa > fb || (fa == fb && ga < gb);
+}
+
+}  // namespace
+
+// static 멤버 변수 정의
+const int AutopilotPolicy::DEFAULT_FLOOD_FILL_LIMIT = 1024;
+const int AutopilotPolicy::DEFAULT_EXPANSION_LIMIT = 16384;
+
+AutopilotPolicy::AutopilotPolicy(int floodFillLimit, int expansionLimit)
+    : floodFillLimit(floodFillLimit), expansionLimit(expansionLimit), width(0), height(0), slotShift(32), generation(0),
+      lastPathLength(-1), lastExpandedCount(0) {
+}
+
+void AutopilotPolicy::beginSearch(const GameMap& map) {
+    width = map.getWidth();
+    height = map.getHeight();
+
+    // 한 번의 탐색이 표에 넣는 칸 수 상한 (A*는 확장마다 이웃 4칸, flood fill은 limit + 3칸)
+    size_t bound = static_cast<size_t>(width) * height;
+    if (expansionLimit > 0) {
+        size_t searchBound = std::max(static_cast<size_t>(expansionLimit) * 4 + 1,
+                                      static_cast<size_t>(std::max(floodFillLimit, 0)) + 4);
+        bound = std::min(bound, searchBound);
+    }
+    // 채움 비율 1/2 이하
+    size_t capacity = 16;
+    int bits = 4;
+    while (capacity < bound * 2) {
+        capacity *= 2;
+        bits++;
+    }
+    if (capacity != slotStamp.size()) {
+        slotStamp.assign(capacity, 0);
+        slotCell.assign(capacity, 0);
+        slotDistance.assign(capacity, 0);
+        slotFirstMove.assign(capacity, NO_DIRECTION);
+        slotShift = 32 - bits;
+        generation = 0;
+    }
+    // 세대 번호가 한 바퀴 돌면 그때만 표시를 지움
+    if (++generation == 0) {
+        std::fill(slotStamp.begin(), slotStamp.end(), 0);
+        generation = 1;
+    }
+}
+
+int AutopilotPolicy::findSlot(int cell) const {
+    // 피보나치 해시 (가까운 칸 번호가 표 전체에 퍼지도록)
+    uint32_t mask = static_cast<uint32_t>(slotStamp.size() - 1);
+    uint32_t slot = (static_cast<uint32_t>(cell) * 2654435761u) >> slotShift;
+    while (slotStamp[slot] == generation && slotCell[slot] != cell) {
+        slot = (slot + 1) & mask;
+    }
+    return static_cast<int>(slot);
+}
+
+int AutopilotPolicy::manhattanToTarget(int x, int y) const {
+    int best = width + height;
+    for (size_t i = 0; i < targetX.size(); i++) {
+        best = std::min(best, std::abs(targetX[i] - x) + std::abs(targetY[i] - y));
+    }
+    return best;
+}
+
+int AutopilotPolicy::estimate(int x, int y) const {
+    int best = manhattanToTarget(x, y);
+    for (size_t i = 0; i < teleportX.size(); i++) {
+        best = std::min(best, std::abs(teleportX[i] - x) + std::abs(teleportY[i] - y) + teleportCost[i]);
+    }
+    return best;
+}
+
+int AutopilotPolicy::findPathToGrowth(const Simulation& simulation, int& firstCell) {
+    targetX.clear();
+    targetY.clear();
+    for (const Item& item : simulation.getItemManager().getItems()) {
+        if (item.getType() == ItemType::GROWTH) {
+            targetX.push_back(item.getX());
+            targetY.push_back(item.getY());
+        }
+    }
+    if (targetX.empty()) {
+        return -1;
+    }
+
+    const GameMap& map = simulation.getMap();
+    beginSearch(map);
+    NavigationGraph graph(simulation);
+    teleportX.clear();
+    teleportY.clear();
+    teleportCost.clear();
+    for (const NavigationGraph::Teleport& teleport : graph.getTeleports()) {
+        teleportX.push_back(teleport.from % width);
+        teleportY.push_back(teleport.from / width);
+        teleportCost.push_back(1 + manhattanToTarget(teleport.exit % width, teleport.exit / width));
+    }
+
+    Position head = simulation.getSnake().getHead();
+    int backward = static_cast<int>(simulation.getSnake().getDirection()) ^ 1;
+    int start = head.y * width + head.x;
+    int startSlot = findSlot(start);
+    slotStamp[startSlot] = generation;
+    slotCell[startSlot] = start;
+    slotDistance[startSlot] = 0;
+    slotFirstMove[startSlot] = NO_DIRECTION;
+
+    auto compare = [](const Node& a, const Node& b) { return lowerPriority(a.f, a.g, b.f, b.g); };
+    frontier.clear();
+    frontier.push_back({estimate(head.x, head.y), 0, start, startSlot});
+
+    while (!frontier.empty()) {
+        std::pop_heap(frontier.begin(), frontier.end(), compare);
+        Node node = frontier.back();
+        frontier.pop_back();
+        if (node.g != slotDistance[node.slot]) {
+            continue;  // 더 짧은 거리로 이미 다시 넣은 칸
+        }
+        if (expansionLimit > 0 && lastExpandedCount >= expansionLimit) {
+            return -1;  // 예산 초과: 목표가 멀거나 닿을 수 없음 (생존 휴리스틱으로)
+        }
+        lastExpandedCount++;
+
+        if (node.index != start && map.getCellAt(node.index) == 5) {
+            lastPathLength = node.g;
+            firstCell = graph.step(start, slotFirstMove[node.slot]);
+            return slotFirstMove[node.slot];
+        }
+
+        for (int direction = 0; direction < 4; direction++) {
+            if (node.index == start && direction == backward) continue;
+            int next = graph.step(node.index, direction);
+            if (next < 0 || next == start) continue;
+            int g = node.g + 1;
+            int slot = findSlot(next);
+            if (slotStamp[slot] == generation && slotDistance[slot] <= g) continue;
+            slotStamp[slot] = generation;
+            slotCell[slot] = next;
+            slotDistance[slot] = g;
+            slotFirstMove[slot] = node.index == start ? static_cast<uint8_t>(direction) : slotFirstMove[node.slot];
+            frontier.push_back({g + estimate(next % width, next / width), g, next, slot});
+            std::push_heap(frontier.begin(), frontier.end(), compare);
+        }
+    }
+    return -1;
+}
+
+int AutopilotPolicy::countReachable(const GameMap& map, int start, int limit) {
+    beginSearch(map);
+    if (!isPassableCell(map.getCellAt(start))) {
+        return 0;
+    }
+    queue.clear();
+    queue.push_back(start);
+    int startSlot = findSlot(start);
+    slotStamp[startSlot] = generation;
+    slotCell[startSlot] = start;
+    for (size_t head = 0; head < queue.size() && static_cast<int>(queue.size()) < limit; head++) {
+        int x = queue[head] % width;
+        int y = queue[head] / width;
+        for (int direction = 0; direction < 4; direction++) {
+            int nx = x + DX[direction];
+            int ny = y + DY[direction];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+            int next = ny * width + nx;
+            if (!isPassableCell(map.getCellAt(next))) continue;
+            int slot = findSlot(next);
+            if (slotStamp[slot] == generation) continue;
+            slotStamp[slot] = generation;
+            slotCell[slot] = next;
+            queue.push_back(next);
+        }
+    }
+    return std::min(static_cast<int>(queue.size()), limit);
+}
+
+int AutopilotPolicy::chooseSurvivalDirection(const Simulation& simulation) {
+    const GameMap& map = simulation.getMap();
+    Position head = simulation.getSnake().getHead();
+    int current = static_cast<int>(simulation.getSnake().getDirection());
+
+    // 직진을 먼저 평가해 넓이가 같으면 방향을 유지
+    int best = -1;
+    int bestArea = 0;
+    int fallback = -1;  // Gate/Poison처럼 죽지는 않는 칸
+    for (int i = 0; i < 4; i++) {
+        int direction = (current + i) % 4;
+        if (direction == (current ^ 1)) continue;
+        int nx = head.x + DX[direction];
+        int ny = head.y + DY[direction];
+        int value = map.getCellValue(nx, ny);
+        if (!isPassableCell(value)) {
+            if (fallback < 0 && SafeMovePolicy::isSafeCell(value)) {
+                fallback = direction;
+            }
+            continue;
+        }
+        int area = countReachable(map, ny * map.getWidth() + nx, floodFillLimit);
+        if (area > bestArea) {
+            bestArea = area;
+            best = direction;
+        }
+    }
+    return best >= 0 ? best : fallback;
+}
+
+GameAction AutopilotPolicy::chooseAction(const Simulation& simulation) {
+    lastPathLength = -1;
+    lastExpandedCount = 0;
+
+    int firstCell = -1;
+    int direction = findPathToGrowth(simulation, firstCell);
+    if (direction >= 0) {
+        // 첫 칸 너머 공간이 뱀 길이보다 좁으면 먹이를 포기하고 생존 우선
+        int needed = std::min(simulation.getSnake().getLength(), floodFillLimit);
+        if (countReachable(simulation.getMap(), firstCell, needed) < needed) {
+            direction = -1;
+        }
+    }
+    if (direction < 0) {
+        direction = chooseSurvivalDirection(simulation);
+    }
+    if (direction < 0 || direction == static_cast<int>(simulation.getSnake().getDirection())) {
+        return GameAction::NONE;
+    }
+    return TURN_ACTIONS[direction];
+}
@@ -0,0 +1,112 @@
+#include "BatchRunner.hpp"
+#include "WorkStealingPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+BatchRunner::BatchRunner(const BatchConfig& config, PolicyFactory policyFactory)
+    : config(config), policyFactory(std::move(policyFactory)) {
+}
+
+uint64_t BatchRunner::gameSeed(uint64_t baseSeed, int gameIndex) {
+    return GameRng(baseSeed).split(static_cast<uint64_t>(gameIndex)).next();
+}
+
+GameResult BatchRunner::playGame(const BatchConfig& config, uint64_t seed, InputPolicy& policy) {
+    Simulation simulation(config.width, config.height, seed);
+
+    while (!simulation.isGameOver() && simulation.getClock().getTickCount() < config.maxTicks) {
+        simulation.applyAction(policy.chooseAction(simulation));
+        simulation.update();
+    }
+
+    const ScoreManager& scoreManager = simulation.getScoreManager();
+    GameResult result;
+    result.seed = seed;
+    result.score = scoreManager.getTotalScore();
+    result.maxLength = scoreManager.getMaxLength();
+    result.gatesUsed = scoreManager.getTotalGatesUsed();
+    result.survivalTicks = simulation.getClock().getTickCount();
+    result.stageReached = simulation.getStageManager().getCurrentStageNumber();
+    result.completed = simulation.isGameCompleted();
+    result.truncated = !simulation.isGameOver();
+    return result;
+}
+
+const std::vector<GameResult>& BatchRunner::run() {
+    auto start = std::chrono::steady_clock::now();
+
+    // 결과는 게임 인덱스 자리에 바로 기록 (게임끼리 공유하는 상태 없음)
+    results.assign(std::max(config.gameCount, 0), GameResult());
+    WorkStealingPool pool(config.threadCount);
+    pool.parallelFor(results.size(), [this](size_t index, int) {
+        uint64_t seed = gameSeed(config.baseSeed, static_cast<int>(index));
+        std::unique_ptr<InputPolicy> policy = policyFactory(seed);
+        results[index] = playGame(config, seed, *policy);
+    });
+
+    summary = summarize(results);
+    summary.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return results;
+}
+
+BatchSummary BatchRunner::summarize(const std::vector<GameResult>& results) {
+    BatchSummary summary;
+    summary.gameCount = static_cast<int>(results.size());
+    if (results.empty()) {
+        return summary;
+    }
+
+    long long scoreSum = 0;
+    long long lengthSum = 0;
+    long long gateSum = 0;
+    for (const GameResult& result : results) {
+        scoreSum += result.score;
+        lengthSum += result.maxLength;
+        gateSum += result.gatesUsed;
+        summary.totalTicks += result.survivalTicks;
+        summary.bestScore = std::max(summary.bestScore, result.score);
+        summary.bestMaxLength = std::max(summary.bestMaxLength, result.maxLength);
+        summary.longestSurvivalTicks = std::max(summary.longestSurvivalTicks, result.survivalTicks);
+        summary.completedCount += result.completed ? 1 : 0;
+        summary.truncatedCount += result.truncated ? 1 : 0;
+
+        if (result.stageReached >= static_cast<int>(summary.stageReachedCounts.size())) {
+            summary.stageReachedCounts.resize(result.stageReached + 1, 0);
+        }
+        summary.stageReachedCounts[result.stageReached]++;
+    }
+
+    double count = static_cast<double>(results.size());
+    summary.meanScore = scoreSum / count;
+    summary.meanMaxLength = lengthSum / count;
+    summary.meanGatesUsed = gateSum / count;
+    summary.meanSurvivalTicks = summary.totalTicks / count;
+    return summary;
+}
+
+void BatchRunner::writeSummary(std::ostream& out, const BatchSummary& summary) {
+    char line[160];
+    std::snprintf(line, sizeof(line), "games            %d (completed %d, truncated %d)\n",
+                  summary.gameCount, summary.completedCount, summary.truncatedCount);
+    out << line;
+    std::snprintf(line, sizeof(line), "score            mean %.1f  best %d\n", summary.meanScore, summary.bestScore);
+    out << line;
+    std::snprintf(line, sizeof(line), "max length       mean %.1f  best %d\n", summary.meanMaxLength, summary.bestMaxLength);
+    out << line;
+    std::snprintf(line, sizeof(line), "gates used       mean %.2f\n", summary.meanGatesUsed);
+    out << line;
+    std::snprintf(line, sizeof(line), "survival ticks   mean %.1f  longest %lld\n",
+                  summary.meanSurvivalTicks, summary.longestSurvivalTicks);
+    out << line;
+    for (size_t stage = 1; stage < summary.stageReachedCounts.size(); stage++) {
+        std::snprintf(line, sizeof(line), "stage %zu reached  %d\n", stage, summary.stageReachedCounts[stage]);
+        out << line;
+    }
+    if (summary.elapsedSeconds > 0.0) {
+        std::snprintf(line, sizeof(line), "elapsed          %.3f s  (%.0f games/s, %.0f ticks/s)\n",
+                      summary.elapsedSeconds, summary.gameCount / summary.elapsedSeconds,
+                      summary.totalTicks / summary.elapsedSeconds);
+        out << line;
+    }
+}
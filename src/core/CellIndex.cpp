@@ -0,0 +1,88 @@
+#include "CellIndex.hpp"
+
+// static 멤버 변수 정의
+const int CellIndex::IMPLICIT;
+
+CellIndex::CellIndex(size_t cellCount)
+    : slotOf(cellCount, -1), stride(0), rectLeft(0), rectTop(0), rectWidth(0), rectHeight(0) {
+}
+
+void CellIndex::reset(size_t cellCount) {
+    cells.clear();
+    slotOf.assign(cellCount, -1);
+    rectWidth = rectHeight = 0;
+}
+
+void CellIndex::assignRect(size_t cellCount, int stride, int left, int top, int rectWidth, int rectHeight) {
+    if (rectWidth <= 0 || rectHeight <= 0) {
+        reset(cellCount);
+        return;
+    }
+    // 두 배열 모두 IMPLICIT 청크 하나를 공유하므로 영역 크기와 관계없이 할당이 거의 없음
+    this->stride = stride;
+    rectLeft = left;
+    rectTop = top;
+    this->rectWidth = rectWidth;
+    this->rectHeight = rectHeight;
+    cells.assign(static_cast<size_t>(rectWidth) * rectHeight, IMPLICIT);
+    slotOf.assign(cellCount, IMPLICIT);
+}
+
+int CellIndex::findSlot(int cell) const {
+    int slot = slotOf[cell];
+    if (slot != IMPLICIT) {
+        return slot;
+    }
+    int x = cell % stride - rectLeft;
+    int y = cell / stride - rectTop;
+    if (x < 0 || x >= rectWidth || y < 0 || y >= rectHeight) {
+        return -1;
+    }
+    return y * rectWidth + x;
+}
+
+void CellIndex::insert(int cell) {
+    if (findSlot(cell) >= 0) return;
+    slotOf.write(cell) = static_cast<int>(cells.size());
+    cells.push_back(cell);
+}
+
+void CellIndex::erase(int cell) {
+    int slot = findSlot(cell);
+    if (slot < 0) return;
+
+    // 마지막 원소를 삭제할 슬롯으로 옮기고 끝을 줄임 (swap-remove)
+    int last = (*this)[cells.size() - 1];
+    cells.set(slot, last);
+    slotOf.write(last) = slot;
+    cells.pop_back();
+    slotOf.write(cell) = -1;
+}
+
+void CellIndex::clear() {
+    // 원소를 하나씩 지우는 대신 -1 청크를 공유하도록 다시 채움
+    slotOf.assign(slotOf.size(), -1);
+    cells.clear();
+    rectWidth = rectHeight = 0;
+}
+
+void CellIndex::saveState(StateWriter& out) const {
+    out.writeVarint(cells.size());
+    for (size_t slot = 0; slot < cells.size(); slot++) {
+        out.writeVarint(static_cast<uint64_t>((*this)[slot]));
+    }
+}
+
+bool CellIndex::loadState(StateReader& in) {
+    size_t count = in.readCount(slotOf.size());
+    clear();
+    for (size_t i = 0; i < count && in.ok(); i++) {
+        uint64_t cell = in.readVarint();
+        if (cell >= slotOf.size() || contains(static_cast<int>(cell))) {
+            in.fail();
+            break;
+        }
+        insert(static_cast<int>(cell));
+    }
+    return in.ok();
+}
@@ -0,0 +1,343 @@
+#include "DistanceFieldCache.hpp"
+#include <algorithm>
+#include <climits>
+#include <functional>
+
+namespace {
+
+const int DX[] = {0, 0, -1, 1};
+const int DY[] = {-1, 1, 0, 0};
+const int INF = INT_MAX;
+
+}  // namespace
+
+// static 멤버 변수 정의
+const int DistanceFieldCache::UNREACHABLE;
+
+DistanceFieldCache::DistanceFieldCache(const Simulation& simulation)
+    : simulation(simulation), width(0), height(0), generation(0), syncedChangeCount(0),
+      lastSyncFull(false), lastRepairedCount(0) {
+    rebuildAll();
+}
+
+bool DistanceFieldCache::isOpenCell(int cellValue) {
+    // 0 빈 칸, 5 Growth, 8 Speed
+    return cellValue == 0 || cellValue == 5 || cellValue == 8;
+}
+
+void DistanceFieldCache::collectTargets() {
+    const GameMap& map = simulation.getMap();
+    targets.clear();
+    for (const Item& item : simulation.getItemManager().getItems()) {
+        targets.push_back(item.getY() * map.getStride() + item.getX());
+    }
+    for (const Gate& gate : simulation.getGateManager().getGates()) {
+        Position position = gate.getPosition();
+        targets.push_back(position.y * map.getStride() + position.x);
+    }
+}
+
+const DistanceFieldCache::Field* DistanceFieldCache::findField(int target) const {
+    for (const Field& field : fields) {
+        if (field.target == target) {
+            return &field;
+        }
+    }
+    return nullptr;
+}
+
+void DistanceFieldCache::rebuildAll() {
+    const GameMap& map = simulation.getMap();
+    if (map.getWidth() != width || map.getHeight() != height) {
+        width = map.getWidth();
+        height = map.getHeight();
+        mark.assign(static_cast<size_t>(width) * height, 0);
+        generation = 0;
+        spareDistances.clear();
+        fields.clear();
+    }
+    open.resize(static_cast<size_t>(width) * height);
+    for (size_t index = 0; index < open.size(); index++) {
+        open[index] = isOpenCell(map.getCellAt(static_cast<int>(index))) ? 1 : 0;
+    }
+
+    for (Field& field : fields) {
+        spareDistances.push_back(std::move(field.distance));
+    }
+    fields.clear();
+    lastRepairedCount = 0;
+    collectTargets();
+    for (int target : targets) {
+        addField(target);
+    }
+
+    syncedChangeCount = map.getChangeCount();
+    lastSyncFull = true;
+}
+
+void DistanceFieldCache::sync() {
+    const GameMap& map = simulation.getMap();
+    uint64_t changeCount = map.getChangeCount();
+    // 바뀐 셀이 많으면 보정보다 전체 BFS가 빠름
+    if (map.getWidth() != width || map.getHeight() != height || !map.hasChangesSince(syncedChangeCount) ||
+        changeCount - syncedChangeCount > open.size() / 4) {
+        rebuildAll();
+        return;
+    }
+    lastRepairedCount = 0;
+
+    // 사라진 목표의 거리장 제거
+    collectTargets();
+    for (size_t i = 0; i < fields.size();) {
+        if (std::find(targets.begin(), targets.end(), fields[i].target) == targets.end()) {
+            spareDistances.push_back(std::move(fields[i].distance));
+            fields[i] = std::move(fields.back());
+            fields.pop_back();
+        } else {
+            i++;
+        }
+    }
+
+    // 열림/막힘이 바뀐 셀마다 남은 거리장 보정 (같은 셀이 여러 번 나와도 결과는 현재 값 기준)
+    for (uint64_t sequence = syncedChangeCount; sequence < changeCount; sequence++) {
+        int index = map.getChangedCell(sequence);
+        uint8_t nowOpen = isOpenCell(map.getCellAt(index)) ? 1 : 0;
+        if (nowOpen == open[index]) continue;
+        open[index] = nowOpen;
+        for (Field& field : fields) {
+            if (nowOpen) {
+                repairOpened(field, index);
+            } else {
+                repairBlocked(field, index);
+            }
+        }
+    }
+
+    // 새 목표는 현재 맵으로 계산
+    for (int target : targets) {
+        if (findField(target) == nullptr) {
+            addField(target);
+        }
+    }
+
+    syncedChangeCount = changeCount;
+    lastSyncFull = false;
+}
+
+void DistanceFieldCache::addField(int target) {
+    Field field;
+    field.target = target;
+    if (!spareDistances.empty()) {
+        field.distance = std::move(spareDistances.back());
+        spareDistances.pop_back();
+    }
+    computeField(field);
+    fields.push_back(std::move(field));
+}
+
+void DistanceFieldCache::computeField(Field& field) {
+    std::vector<int>& distance = field.distance;
+    distance.assign(open.size(), INF);
+    distance[field.target] = 0;
+    queue.clear();
+    queue.push_back(field.target);
+    for (size_t head = 0; head < queue.size(); head++) {
+        int index = queue[head];
+        int x = index % width;
+        int y = index / width;
+        for (int direction = 0; direction < 4; direction++) {
+            int nx = x + DX[direction];
+            int ny = y + DY[direction];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+            int next = ny * width + nx;
+            if (!open[next] || distance[next] != INF) continue;
+            distance[next] = distance[index] + 1;
+            queue.push_back(next);
+        }
+    }
+    lastRepairedCount += static_cast<long long>(queue.size());
+}
+
+void DistanceFieldCache::nextGeneration() {
+    if (++generation == 0) {
+        std::fill(mark.begin(), mark.end(), 0);
+        generation = 1;
+    }
+}
+
+void DistanceFieldCache::repairOpened(Field& field, int index) {
+    if (index == field.target) {
+        return;
+    }
+    std::vector<int>& distance = field.distance;
+    int x = index % width;
+    int y = index / width;
+    int best = INF;
+    for (int direction = 0; direction < 4; direction++) {
+        int nx = x + DX[direction];
+        int ny = y + DY[direction];
+        if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+        int neighbor = distance[ny * width + nx];
+        if (neighbor != INF) {
+            best = std::min(best, neighbor + 1);
+        }
+    }
+    if (best == INF) {
+        return;  // 아직 목표와 이어지지 않은 영역
+    }
+
+    // 새로 열린 칸에서 거리가 줄어드는 칸으로만 퍼짐
+    distance[index] = best;
+    queue.clear();
+    queue.push_back(index);
+    for (size_t head = 0; head < queue.size(); head++) {
+        int current = queue[head];
+        int cx = current % width;
+        int cy = current / width;
+        int nextDistance = distance[current] + 1;
+        for (int direction = 0; direction < 4; direction++) {
+            int nx = cx + DX[direction];
+            int ny = cy + DY[direction];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+            int next = ny * width + nx;
+            if (!open[next] || next == field.target || distance[next] <= nextDistance) continue;
+            distance[next] = nextDistance;
+            queue.push_back(next);
+        }
+    }
+    lastRepairedCount += static_cast<long long>(queue.size());
+}
+
+bool DistanceFieldCache::hasSupport(const Field& field, int index) const {
+    int wanted = field.distance[index] - 1;
+    int x = index % width;
+    int y = index / width;
+    for (int direction = 0; direction < 4; direction++) {
+        int nx = x + DX[direction];
+        int ny = y + DY[direction];
+        if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+        int neighbor = ny * width + nx;
+        if (field.distance[neighbor] == wanted && mark[neighbor] != generation) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void DistanceFieldCache::repairBlocked(Field& field, int index) {
+    if (index == field.target) {
+        return;
+    }
+    std::vector<int>& distance = field.distance;
+    int removed = distance[index];
+    distance[index] = INF;
+    if (removed == INF) {
+        return;
+    }
+
+    // 1단계: 막힌 칸을 거쳐야만 하던 칸 찾기 (거리 순으로 퍼지므로 한 단계 앞 칸은 이미 판정됨)
+    nextGeneration();
+    mark[index] = generation;
+    queue.clear();
+    queue.push_back(index);
+    for (size_t head = 0; head < queue.size(); head++) {
+        int current = queue[head];
+        int cx = current % width;
+        int cy = current / width;
+        int childDistance = (current == index ? removed : distance[current]) + 1;
+        for (int direction = 0; direction < 4; direction++) {
+            int nx = cx + DX[direction];
+            int ny = cy + DY[direction];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+            int next = ny * width + nx;
+            if (mark[next] == generation || !open[next] || next == field.target) continue;
+            if (distance[next] != childDistance || hasSupport(field, next)) continue;
+            mark[next] = generation;
+            queue.push_back(next);
+        }
+    }
+
+    // 2단계: 영향받은 칸을 바깥 경계의 거리에서 다시 채움 (경계 거리가 제각각이라 최소 힙 사용)
+    for (size_t i = 1; i < queue.size(); i++) {
+        distance[queue[i]] = INF;
+    }
+    heap.clear();
+    for (size_t i = 1; i < queue.size(); i++) {
+        int current = queue[i];
+        int cx = current % width;
+        int cy = current / width;
+        int best = INF;
+        for (int direction = 0; direction < 4; direction++) {
+            int nx = cx + DX[direction];
+            int ny = cy + DY[direction];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+            int neighbor = ny * width + nx;
+            if (mark[neighbor] != generation && distance[neighbor] != INF) {
+                best = std::min(best, distance[neighbor] + 1);
+            }
+        }
+        if (best != INF) {
+            distance[current] = best;
+            heap.emplace_back(best, current);
+        }
+    }
+    std::make_heap(heap.begin(), heap.end(), std::greater<std::pair<int, int>>());
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<std::pair<int, int>>());
+        std::pair<int, int> entry = heap.back();
+        heap.pop_back();
+        if (entry.first != distance[entry.second]) continue;
+        int cx = entry.second % width;
+        int cy = entry.second / width;
+        for (int direction = 0; direction < 4; direction++) {
+            int nx = cx + DX[direction];
+            int ny = cy + DY[direction];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+            int next = ny * width + nx;
+            if (mark[next] != generation || next == index || entry.first + 1 >= distance[next]) continue;
+            distance[next] = entry.first + 1;
+            heap.emplace_back(entry.first + 1, next);
+            std::push_heap(heap.begin(), heap.end(), std::greater<std::pair<int, int>>());
+        }
+    }
+    lastRepairedCount += static_cast<long long>(queue.size());
+}
+
+int DistanceFieldCache::getDistance(int targetX, int targetY, int x, int y) const {
+    if (targetX < 0 || targetX >= width || targetY < 0 || targetY >= height ||
+        x < 0 || x >= width || y < 0 || y >= height) {
+        return UNREACHABLE;
+    }
+    const Field* field = findField(targetY * width + targetX);
+    if (field == nullptr) {
+        return UNREACHABLE;
+    }
+    int index = y * width + x;
+    if (index == field->target || open[index]) {
+        return field->distance[index] == INF ? UNREACHABLE : field->distance[index];
+    }
+    int best = INF;
+    for (int direction = 0; direction < 4; direction++) {
+        int nx = x + DX[direction];
+        int ny = y + DY[direction];
+        if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+        int neighbor = field->distance[ny * width + nx];
+        if (neighbor != INF) {
+            best = std::min(best, neighbor + 1);
+        }
+    }
+    return best == INF ? UNREACHABLE : best;
+}
+
+int DistanceFieldCache::getNearestDistance(int cellValue, int x, int y) const {
+    const GameMap& map = simulation.getMap();
+    int best = UNREACHABLE;
+    for (const Field& field : fields) {
+        if (map.getCellAt(field.target) != cellValue) continue;
+        int distance = getDistance(field.target % width, field.target / width, x, y);
+        if (distance != UNREACHABLE && (best == UNREACHABLE || distance < best)) {
+            best = distance;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,44 @@
+#include "ExpiryScheduler.hpp"
+#include <algorithm>
+
+ExpiryScheduler::ExpiryScheduler() {
+}
+
+void ExpiryScheduler::schedule(int key, GameClock::time_point deadline) {
+    heap.push_back(Entry{deadline, key});
+    std::push_heap(heap.begin(), heap.end(), later);
+}
+
+void ExpiryScheduler::popDue(GameClock::time_point now, std::vector<int>& out) {
+    while (hasDue(now)) {
+        std::pop_heap(heap.begin(), heap.end(), later);
+        out.push_back(heap.back().key);
+        heap.pop_back();
+    }
+}
+
+void ExpiryScheduler::saveState(StateWriter& out) const {
+    out.writeVarint(heap.size());
+    for (const Entry& entry : heap) {
+        out.writeInt(entry.deadline.time_since_epoch().count());
+        out.writeInt(entry.key);
+    }
+}
+
+bool ExpiryScheduler::loadState(StateReader& in, size_t maxEntries) {
+    size_t count = in.readCount(maxEntries);
+    heap.clear();
+    heap.reserve(count);
+    for (size_t i = 0; i < count && in.ok(); i++) {
+        Entry entry;
+        entry.deadline = GameClock::time_point(GameClock::duration(in.readInt()));
+        entry.key = in.readInt32();
+        heap.push_back(entry);
+    }
+    if (!in.ok() || !std::is_heap(heap.begin(), heap.end(), later)) {
+        heap.clear();
+        in.fail();
+        return false;
+    }
+    return true;
+}
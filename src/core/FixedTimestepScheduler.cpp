@@ -0,0 +1,94 @@
+#include "FixedTimestepScheduler.hpp"
+
+FixedTimestepScheduler::FixedTimestepScheduler(int maxCatchUpTicks, int maxSkippedFrames)
+    : maxCatchUpTicks(maxCatchUpTicks), maxSkippedFrames(maxSkippedFrames),
+      tickDuration(std::chrono::milliseconds(200)), ticksThisFrame(0), skippedFramesInRow(0),
+      tickCount(0), droppedTicks(0), droppedFrames(0), windowTicks(0), windowLatenessMs(0.0),
+      achievedTickRate(0.0), jitterMs(0.0) {
+}
+
+void FixedTimestepScheduler::start(time_point now, duration newTickDuration) {
+    tickDuration = newTickDuration;
+    nextDeadline = now + tickDuration;
+    lastTickDeadline = now;
+    frameNow = now;
+    ticksThisFrame = 0;
+    skippedFramesInRow = 0;
+
+    tickCount = 0;
+    droppedTicks = 0;
+    droppedFrames = 0;
+    windowStart = now;
+    windowTicks = 0;
+    windowLatenessMs = 0.0;
+    achievedTickRate = 0.0;
+    jitterMs = 0.0;
+}
+
+void FixedTimestepScheduler::beginFrame(time_point now) {
+    frameNow = now;
+    ticksThisFrame = 0;
+
+    // 따라잡을 수 있는 틱 수를 넘게 밀렸으면 오래된 틱은 버림 (정확한 배수로 건너뜀)
+    if (now >= nextDeadline) {
+        long long behind = (now - nextDeadline) / tickDuration + 1;
+        if (behind > maxCatchUpTicks) {
+            long long dropped = behind - maxCatchUpTicks;
+            nextDeadline += tickDuration * dropped;
+            droppedTicks += dropped;
+        }
+    }
+
+    updateWindow();
+}
+
+bool FixedTimestepScheduler::consumeTick() {
+    if (frameNow < nextDeadline || ticksThisFrame >= maxCatchUpTicks) {
+        return false;
+    }
+
+    // 마감 시각 대비 실제 실행 지연 기록
+    windowLatenessMs += std::chrono::duration<double, std::milli>(frameNow - nextDeadline).count();
+    windowTicks++;
+    tickCount++;
+    ticksThisFrame++;
+
+    lastTickDeadline = nextDeadline;
+    nextDeadline += tickDuration;
+    return true;
+}
+
+void FixedTimestepScheduler::setTickDuration(duration newTickDuration) {
+    if (newTickDuration == tickDuration) {
+        return;
+    }
+    tickDuration = newTickDuration;
+    nextDeadline = lastTickDeadline + tickDuration;
+}
+
+bool FixedTimestepScheduler::shouldRender(time_point now) {
+    // 밀린 틱이 남아 있으면 그리기를 미루고 틱을 먼저 처리
+    if (now >= nextDeadline && skippedFramesInRow < maxSkippedFrames) {
+        skippedFramesInRow++;
+        droppedFrames++;
+        return false;
+    }
+    skippedFramesInRow = 0;
+    return true;
+}
+
+void FixedTimestepScheduler::updateWindow() {
+    // 1초마다 틱 속도와 지터 갱신
+    auto elapsed = frameNow - windowStart;
+    if (elapsed < std::chrono::seconds(1)) {
+        return;
+    }
+
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    achievedTickRate = windowTicks / seconds;
+    jitterMs = windowTicks > 0 ? windowLatenessMs / windowTicks : 0.0;
+
+    windowStart = frameNow;
+    windowTicks = 0;
+    windowLatenessMs = 0.0;
+}
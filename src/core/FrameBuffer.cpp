@@ -0,0 +1,41 @@
+#include "FrameBuffer.hpp"
+
+FrameBuffer::FrameBuffer() : width(0), height(0), fullRedraw(true) {
+}
+
+void FrameBuffer::resize(int newWidth, int newHeight) {
+    width = newWidth;
+    height = newHeight;
+    front.assign(static_cast<size_t>(width) * height, FrameCell{' ', 0});
+    back.assign(static_cast<size_t>(width) * height, FrameCell{' ', 0});
+    fullRedraw = true;
+}
+
+void FrameBuffer::diff(std::vector<FrameRun>& runs) {
+    for (int y = 0; y < height; y++) {
+        int rowStart = y * width;
+        int x = 0;
+        while (x < width) {
+            const FrameCell& cell = back[rowStart + x];
+            if (!fullRedraw && cell == front[rowStart + x]) {
+                x++;
+                continue;
+            }
+
+            // 같은 색상으로 이어지는 바뀐 칸들을 하나의 묶음으로
+            FrameRun run{x, y, cell.colorPair, std::string()};
+            while (x < width) {
+                const FrameCell& next = back[rowStart + x];
+                if (next.colorPair != run.colorPair ||
+                    (!fullRedraw && next == front[rowStart + x])) {
+                    break;
+                }
+                run.text.push_back(next.glyph);
+                front[rowStart + x] = next;
+                x++;
+            }
+            runs.push_back(std::move(run));
+        }
+    }
+    fullRedraw = false;
+}
@@ -0,0 +1,25 @@
+#include "GameClock.hpp"
+
+GameClock::GameClock() : currentTime(duration::zero()), tickCount(0) {
+}
+
+void GameClock::advance(duration delta) {
+    currentTime += delta;
+    tickCount++;
+}
+
+void GameClock::reset() {
+    currentTime = time_point(duration::zero());
+    tickCount = 0;
+}
+
+void GameClock::saveState(StateWriter& out) const {
+    out.writeInt(currentTime.time_since_epoch().count());
+    out.writeInt(tickCount);
+}
+
+bool GameClock::loadState(StateReader& in) {
+    currentTime = time_point(duration(in.readInt()));
+    tickCount = in.readInt();
+    return in.ok();
+}
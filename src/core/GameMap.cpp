@@ -1,7 +1,25 @@
 #include "GameMap.hpp"
+#include <algorithm>
 
-GameMap::GameMap(int width, int height) : width(width), height(height), colorManager(nullptr) {
-    map.resize(height, std::vector<int>(width, 0));
+// static 멤버 변수 정의
+const uint8_t GameMap::MAX_CELL_VALUE;
+const int GameMap::MIN_SIZE = 21;
+const int GameMap::MAX_SIZE = 8192;
+
+GameMap::GameMap(int width, int height)
+    : width(width), height(height), cells(static_cast<size_t>(width) * height, 0),
+      dirtyFlags(cells.size(), 0), allDirty(true), changeCount(0), freeCells(cells.size()) {
+    // 변경 기록은 셀 수 이상 (한 번의 전체 재구성을 담을 수 있는 크기)
+    size_t journalSize = 64;
+    while (journalSize < cells.size()) {
+        journalSize *= 2;
+    }
+    changeJournal.assign(journalSize, 0);
+    changeJournalMask = journalSize - 1;
+
+    for (auto& index : wallCells) {
+        index.reset(cells.size());
+    }
     initializeMap();
 }
 
@@ -9,30 +27,77 @@ GameMap::~GameMap() {
     // vector는 자동으로 메모리 해제
 }
 
-void GameMap::setColorManager(std::shared_ptr<ColorManager> colorMgr) {
-    colorManager = colorMgr;
+void GameMap::reset() {
+    // 셀/플래그/인덱스 배열은 같은 값의 청크를 공유하도록 다시 채움 (생성자와 같은 순서)
+    cells.assign(cells.size(), 0);
+    dirtyFlags.assign(cells.size(), 0);
+    dirtyCells.clear();
+    allDirty = true;
+    for (auto& index : wallCells) {
+        index.clear();
+    }
+
+    // 기록 한 바퀴만큼 번호를 건너뛰어 이전 번호로 동기화하던 소비자가 전체를 다시 읽게 함
+    changeCount += changeJournal.size();
+    initializeMap();
 }
 
 void GameMap::initializeMap() {
     // 맵 테두리를 Immune Wall(2)로 초기화
     for (int i = 0; i < width; i++) {
-        map[0][i] = 2;      // 상단 벽
-        map[height-1][i] = 2; // 하단 벽
+        setCellUnchecked(i, 0, 2);          // 상단 벽
+        setCellUnchecked(i, height - 1, 2); // 하단 벽
     }
     for (int i = 0; i < height; i++) {
-        map[i][0] = 2;      // 좌측 벽
-        map[i][width-1] = 2; // 우측 벽
+        setCellUnchecked(0, i, 2);          // 좌측 벽
+        setCellUnchecked(width - 1, i, 2);  // 우측 벽
+    }
+
+    // 내부 셀은 모두 빈 공간으로 시작 (인덱스는 처음 바뀌는 청크만 할당)
+    freeCells.assignRect(cells.size(), width, 1, 1, width - 2, height - 2);
+}
+
+void GameMap::updateCellIndices(int x, int y, uint8_t newValue) {
+    int index = y * width + x;
+    bool isBorder = (x == 0 || x == width - 1 || y == 0 || y == height - 1);
+
+    // 빈 셀 인덱스 (테두리는 항상 벽이므로 제외)
+    if (!isBorder) {
+        if (newValue == 0) {
+            freeCells.insert(index);
+        } else {
+            freeCells.erase(index);
+        }
+    }
+
+    // 벽 셀 인덱스 (모서리는 Gate를 둘 수 없으므로 제외)
+    bool isCorner = (x == 0 || x == width - 1) && (y == 0 || y == height - 1);
+    if (!isCorner) {
+        CellIndex& walls = wallCells[static_cast<int>(getWallSide(x, y))];
+        if (isWallValue(newValue)) {
+            walls.insert(index);
+        } else {
+            walls.erase(index);
+        }
     }
 }
 
+WallSide GameMap::getWallSide(int x, int y) const {
+    if (y == 0) return WallSide::TOP;
+    if (y == height - 1) return WallSide::BOTTOM;
+    if (x == 0) return WallSide::LEFT;
+    if (x == width - 1) return WallSide::RIGHT;
+    return WallSide::INNER;
+}
+
 int GameMap::getCellValue(int x, int y) const {
     if (!isValidPosition(x, y)) return -1;
-    return map[y][x];
+    return getCellUnchecked(x, y);
 }
 
 void GameMap::setCellValue(int x, int y, int value) {
     if (!isValidPosition(x, y)) return;
-    map[y][x] = value;
+    setCellUnchecked(x, y, static_cast<uint8_t>(value));
 }
 
 void GameMap::setWall(int x, int y) {
@@ -55,6 +120,23 @@ void GameMap::setTemporaryWall(int x, int y) {
     setCellValue(x, y, 9);
 }
 
+void GameMap::markDirty(int x, int y) {
+    if (!isValidPosition(x, y)) return;
+    int index = y * width + x;
+    if (!dirtyFlags[index]) {
+        dirtyFlags.write(index) = 1;
+        dirtyCells.push_back(index);
+    }
+}
+
+void GameMap::clearDirty() {
+    for (int index : dirtyCells) {
+        dirtyFlags.write(index) = 0;
+    }
+    dirtyCells.clear();
+    allDirty = false;
+}
+
 bool GameMap::isValidPosition(int x, int y) const {
     return x >= 0 && x < width && y >= 0 && y < height;
 }
@@ -67,9 +149,9 @@ std::optional<std::pair<int, int>> GameMap::findSafePosition() const {
     for (int y = 1; y < height - 1; y++) {
         for (int x = 3; x < width - 1; x++) {
             // 머리, 몸통, 꼬리 위치가 모두 빈 공간인지 확인
-            if (map[y][x] == 0 &&           // 머리 위치
-                map[y][x-1] == 0 &&         // 몸통 위치
-                map[y][x-2] == 0) {         // 꼬리 위치
+            if (getCellUnchecked(x, y) == 0 &&       // 머리 위치
+                getCellUnchecked(x - 1, y) == 0 &&   // 몸통 위치
+                getCellUnchecked(x - 2, y) == 0) {   // 꼬리 위치
                 
                 return std::make_pair(x, y);
             }
@@ -80,90 +162,118 @@ std::optional<std::pair<int, int>> GameMap::findSafePosition() const {
     return std::nullopt;
 }
 
-void GameMap::draw() const {
-    clear();  // 화면 지우기
+void GameMap::copyCellsTo(uint8_t* out) const {
+    for (size_t chunk = 0; chunk < cells.getChunkCount(); chunk++) {
+        size_t length = cells.getChunkLength(chunk);
+        std::copy(cells.getChunkData(chunk), cells.getChunkData(chunk) + length, out);
+        out += length;
+    }
+}
+
+void GameMap::saveState(StateWriter& out) const {
+    for (size_t chunk = 0; chunk < cells.getChunkCount(); chunk++) {
+        out.writeBytes(cells.getChunkData(chunk), cells.getChunkLength(chunk));
+    }
+
+    out.writeBool(allDirty);
+    out.writeVarint(dirtyCells.size());
+    for (int index : dirtyCells) {
+        out.writeVarint(static_cast<uint64_t>(index));
+    }
+
+    freeCells.saveState(out);
+    for (const auto& index : wallCells) {
+        index.saveState(out);
+    }
+}
+
+bool GameMap::loadState(StateReader& in) {
+    if (in.remaining() < cells.size()) {
+        in.fail();
+        return false;
+    }
+
+    // 값이 다른 셀만 덮어쓰고 변경 기록에 추가 (셀 인덱스는 아래에서 통째로 복원)
+    const uint8_t* saved = in.current();
+    for (size_t i = 0; i < cells.size(); i++) {
+        if (saved[i] > MAX_CELL_VALUE) {
+            in.fail();
+            return false;
+        }
+        if (cells[i] != saved[i]) {
+            cells.write(i) = saved[i];
+            changeJournal.write(changeCount++ & changeJournalMask) = static_cast<int>(i);
+        }
+    }
+    in.skip(cells.size());
+
+    // 변경 표시 (이전 표시는 지움)
+    for (int index : dirtyCells) {
+        dirtyFlags.write(index) = 0;
+    }
+    dirtyCells.clear();
+    allDirty = in.readBool();
+    size_t dirtyCount = in.readCount(cells.size());
+    for (size_t i = 0; i < dirtyCount && in.ok(); i++) {
+        uint64_t index = in.readVarint();
+        if (index >= cells.size() || dirtyFlags[index]) {
+            in.fail();
+            break;
+        }
+        dirtyFlags.write(index) = 1;
+        dirtyCells.push_back(static_cast<int>(index));
+    }
 
+    freeCells.loadState(in);
+    for (auto& index : wallCells) {
+        index.loadState(in);
+    }
+    // 인덱스가 셀과 어긋나면 빈 칸 추출이 벽 위에 아이템을 놓는 등 게임이 깨짐
+    if (in.ok() && !indicesMatchCells()) {
+        in.fail();
+    }
+    return in.ok();
+}
+
+bool GameMap::indicesMatchCells() const {
+    // 모든 슬롯이 조건에 맞는 셀이고 개수도 같으면 (슬롯 중복은 CellIndex가 막음) 집합이 같음
+    size_t freeCount = 0;
+    std::array<size_t, WALL_SIDE_COUNT> wallCounts{};
     for (int y = 0; y < height; y++) {
         for (int x = 0; x < width; x++) {
-            move(y, x);  // 커서 이동
-            
-            // 색상 적용
-            if (colorManager) {
-                switch (map[y][x]) {
-                    case 1:  // Wall
-                        colorManager->applyColor(ColorType::WALL);
-                        break;
-                    case 2:  // Immune Wall
-                        colorManager->applyColor(ColorType::IMMUNE_WALL);
-                        break;
-                    case 3:  // Snake Head
-                        colorManager->applyColor(ColorType::SNAKE_HEAD);
-                        break;
-                    case 4:  // Snake Body
-                        colorManager->applyColor(ColorType::SNAKE_BODY);
-                        break;
-                    case 5:  // Growth Item
-                        colorManager->applyColor(ColorType::GROWTH_ITEM);
-                        break;
-                    case 6:  // Poison Item
-                        colorManager->applyColor(ColorType::POISON_ITEM);
-                        break;
-                    case 7:  // Gate
-                        colorManager->applyColor(ColorType::GATE);
-                        break;
-                    case 8:  // Speed Item
-                        colorManager->applyColor(ColorType::SPEED_ITEM);
-                        break;
-                    case 9:  // Temporary Wall
-                        colorManager->applyColor(ColorType::WALL);  // 일반 벽과 같은 색상 사용
-                        break;
-                    default:
-                        colorManager->applyColor(ColorType::DEFAULT);
-                        break;
-                }
+            uint8_t value = getCellUnchecked(x, y);
+            bool isBorder = (x == 0 || x == width - 1 || y == 0 || y == height - 1);
+            bool isCorner = (x == 0 || x == width - 1) && (y == 0 || y == height - 1);
+            if (!isBorder && value == 0) {
+                freeCount++;
             }
-            
-            // 문자 출력
-            switch (map[y][x]) {
-                case 0:  // 빈 공간
-                    addch(' ');
-                    break;
-                case 1:  // Wall
-                    addch('#');
-                    break;
-                case 2:  // Immune Wall
-                    addch('*');
-                    break;
-                case 3:  // Snake Head
-                    addch('@');
-                    break;
-                case 4:  // Snake Body
-                    addch('o');
-                    break;
-                case 5:  // Growth Item
-                    addch('+');
-                    break;
-                case 6:  // Poison Item
-                    addch('-');
-                    break;
-                case 7:  // Gate
-                    addch('G');
-                    break;
-                case 8:  // Speed Item
-                    addch('*');
-                    break;
-                case 9:  // Temporary Wall
-                    addch('T');
-                    break;
-                default:
-                    addch('?');
+            if (!isCorner && isWallValue(value)) {
+                wallCounts[static_cast<int>(getWallSide(x, y))]++;
             }
-            
-            // 색상 해제
-            if (colorManager) {
-                colorManager->resetColor();
+        }
+    }
+
+    if (freeCells.size() != freeCount) {
+        return false;
+    }
+    for (size_t slot = 0; slot < freeCells.size(); slot++) {
+        auto [x, y] = cellPosition(freeCells[slot]);
+        if (getCellUnchecked(x, y) != 0 || getWallSide(x, y) != WallSide::INNER) {
+            return false;
+        }
+    }
+    for (int side = 0; side < WALL_SIDE_COUNT; side++) {
+        const CellIndex& walls = wallCells[side];
+        if (walls.size() != wallCounts[side]) {
+            return false;
+        }
+        for (size_t slot = 0; slot < walls.size(); slot++) {
+            auto [x, y] = cellPosition(walls[slot]);
+            bool isCorner = (x == 0 || x == width - 1) && (y == 0 || y == height - 1);
+            if (isCorner || !isWallValue(getCellUnchecked(x, y)) || static_cast<int>(getWallSide(x, y)) != side) {
+                return false;
             }
         }
     }
-    refresh();  // 화면 갱신
-} 
\ No newline at end of file
+    return true;
+}
@@ -0,0 +1,52 @@
+#include "GameRng.hpp"
+#include <algorithm>
+#include <random>
+
+GameRng::GameRng(uint64_t seed) {
+    this->seed(seed);
+}
+
+void GameRng::seed(uint64_t seed) {
+    // splitmix64로 상태 4워드를 채움 (모두 0이 되는 경우 없음)
+    for (uint64_t& word : state) {
+        word = splitMix64(seed);
+    }
+}
+
+GameRng GameRng::split(uint64_t stream) const {
+    uint64_t mixed = state[0] ^ rotl(state[1], 17) ^ rotl(state[2], 31) ^ rotl(state[3], 47);
+    mixed += (stream + 1) * 0x9E3779B97F4A7C15ULL;
+    return GameRng(splitMix64(mixed));
+}
+
+void GameRng::saveState(StateWriter& out) const {
+    for (uint64_t word : state) {
+        out.writeFixed64(word);
+    }
+}
+
+bool GameRng::loadState(StateReader& in) {
+    uint64_t words[4];
+    for (uint64_t& word : words) {
+        word = in.readFixed64();
+    }
+    // 모두 0인 상태는 xoshiro에서 영원히 0만 나오므로 거부
+    if (!in.ok() || (words[0] | words[1] | words[2] | words[3]) == 0) {
+        in.fail();
+        return false;
+    }
+    std::copy(words, words + 4, state);
+    return true;
+}
+
+uint64_t GameRng::splitMix64(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+uint64_t GameRng::randomSeed() {
+    std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32) ^ device();
+}
@@ -0,0 +1,88 @@
+#include "InputPolicy.hpp"
+
+namespace {
+
+const Direction DIRECTIONS[] = {Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT};
+
+GameAction turnAction(Direction direction) {
+    switch (direction) {
+        case Direction::UP:    return GameAction::TURN_UP;
+        case Direction::DOWN:  return GameAction::TURN_DOWN;
+        case Direction::LEFT:  return GameAction::TURN_LEFT;
+        case Direction::RIGHT: return GameAction::TURN_RIGHT;
+    }
+    return GameAction::NONE;
+}
+
+Position step(const Position& from, Direction direction) {
+    switch (direction) {
+        case Direction::UP:    return Position(from.x, from.y - 1);
+        case Direction::DOWN:  return Position(from.x, from.y + 1);
+        case Direction::LEFT:  return Position(from.x - 1, from.y);
+        case Direction::RIGHT: return Position(from.x + 1, from.y);
+    }
+    return from;
+}
+
+bool isOpposite(Direction a, Direction b) {
+    return (a == Direction::UP && b == Direction::DOWN) || (a == Direction::DOWN && b == Direction::UP) ||
+           (a == Direction::LEFT && b == Direction::RIGHT) || (a == Direction::RIGHT && b == Direction::LEFT);
+}
+
+}  // namespace
+
+RandomTurnPolicy::RandomTurnPolicy(uint64_t seed, int turnPercent)
+    : rng(seed), turnPercent(turnPercent) {
+}
+
+GameAction RandomTurnPolicy::chooseAction(const Simulation& simulation) {
+    (void)simulation;
+    if (!rng.chance(turnPercent)) {
+        return GameAction::NONE;
+    }
+    return turnAction(DIRECTIONS[rng.uniformInt(4)]);
+}
+
+SafeMovePolicy::SafeMovePolicy(uint64_t seed, int turnPercent)
+    : rng(seed), turnPercent(turnPercent) {
+}
+
+bool SafeMovePolicy::isSafeCell(int cellValue) {
+    // 0 빈 칸, 5 Growth, 6 Poison, 7 Gate, 8 Speed
+    return cellValue == 0 || cellValue == 5 || cellValue == 6 || cellValue == 7 || cellValue == 8;
+}
+
+GameAction SafeMovePolicy::chooseAction(const Simulation& simulation) {
+    const Snake& snake = simulation.getSnake();
+    const GameMap& map = simulation.getMap();
+    Position head = snake.getHead();
+    Direction current = snake.getDirection();
+
+    Direction safe[4];
+    int safeCount = 0;
+    for (Direction direction : DIRECTIONS) {
+        if (isOpposite(direction, current)) continue;
+        Position next = step(head, direction);
+        int value = map.getCellValue(next.x, next.y);
+        if (value == 5 || value == 8) {
+            return direction == current ? GameAction::NONE : turnAction(direction);
+        }
+        if (isSafeCell(value)) {
+            safe[safeCount++] = direction;
+        }
+    }
+    if (safeCount == 0) {
+        return GameAction::NONE;  // 갈 곳이 없음
+    }
+
+    // 직진이 안전하면 대부분 유지, 가끔 무작위로 꺾음
+    bool straightSafe = false;
+    for (int i = 0; i < safeCount; i++) {
+        straightSafe = straightSafe || safe[i] == current;
+    }
+    if (straightSafe && !rng.chance(turnPercent)) {
+        return GameAction::NONE;
+    }
+    Direction chosen = safe[rng.uniformInt(safeCount)];
+    return chosen == current ? GameAction::NONE : turnAction(chosen);
+}
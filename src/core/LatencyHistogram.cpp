@@ -0,0 +1,83 @@
+#include "LatencyHistogram.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// static 멤버 변수 정의
+const int LatencyHistogram::SUB_BUCKET_BITS;
+const int LatencyHistogram::SUB_BUCKET_COUNT;
+const int LatencyHistogram::BUCKET_COUNT;
+
+LatencyHistogram::LatencyHistogram() {
+    reset();
+}
+
+int LatencyHistogram::bucketIndex(uint64_t value) {
+    // 최상위 비트 위치 = 거듭제곱 구간, 최상위 비트를 포함한 위 5비트 = 16 + 선형 하위 구간
+    // value | SUB_BUCKET_COUNT로 16 미만도 shift 0이 되어 그대로 value (선형 구간을 분기 없이 접음)
+    int shift = 63 - __builtin_clzll(value | SUB_BUCKET_COUNT) - SUB_BUCKET_BITS;
+    return shift * SUB_BUCKET_COUNT + static_cast<int>(value >> shift);
+}
+
+uint64_t LatencyHistogram::bucketLowerBound(int index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return static_cast<uint64_t>(index);
+    }
+    int exponent = index / SUB_BUCKET_COUNT + SUB_BUCKET_BITS - 1;
+    uint64_t subBucket = static_cast<uint64_t>(index % SUB_BUCKET_COUNT);
+    return (SUB_BUCKET_COUNT + subBucket) << (exponent - SUB_BUCKET_BITS);
+}
+
+uint64_t LatencyHistogram::bucketWidth(int index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return 1;
+    }
+    int exponent = index / SUB_BUCKET_COUNT + SUB_BUCKET_BITS - 1;
+    return uint64_t(1) << (exponent - SUB_BUCKET_BITS);
+}
+
+void LatencyHistogram::record(uint64_t value) {
+    buckets[bucketIndex(value)]++;
+    count++;
+    sum += value;
+    minValue = std::min(minValue, value);
+    maxValue = std::max(maxValue, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        buckets[i] += other.buckets[i];
+    }
+    count += other.count;
+    sum += other.sum;
+    minValue = std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+}
+
+void LatencyHistogram::reset() {
+    buckets.fill(0);
+    count = 0;
+    sum = 0;
+    minValue = std::numeric_limits<uint64_t>::max();
+    maxValue = 0;
+}
+
+uint64_t LatencyHistogram::percentile(double q) const {
+    if (count == 0) {
+        return 0;
+    }
+
+    // q 위치의 기록이 속한 구간을 누적 합으로 찾음
+    uint64_t rank = static_cast<uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * count));
+    rank = std::max<uint64_t>(rank, 1);
+
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            uint64_t middle = bucketLowerBound(i) + (bucketWidth(i) - 1) / 2;
+            return std::clamp(middle, getMin(), maxValue);
+        }
+    }
+    return maxValue;
+}
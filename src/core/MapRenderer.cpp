@@ -0,0 +1,106 @@
+#include "MapRenderer.hpp"
+
+MapRenderer::MapRenderer() : colorManager(nullptr) {
+}
+
+MapRenderer::~MapRenderer() {
+    // 자동으로 메모리 해제
+}
+
+void MapRenderer::setColorManager(std::shared_ptr<ColorManager> colorMgr) {
+    colorManager = colorMgr;
+    frameBuffer.invalidate();
+}
+
+void MapRenderer::draw(const GameMap& map) {
+    // 보이는 영역의 가운데를 따라가면 카메라는 그대로 (맵/화면 크기가 바뀐 경우만 보정)
+    draw(map, viewport.getX() + viewport.getWidth() / 2, viewport.getY() + viewport.getHeight() / 2);
+}
+
+void MapRenderer::draw(const GameMap& map, int focusX, int focusY) {
+    viewport.follow(map.getWidth(), map.getHeight(), focusX, focusY);
+    if (frameBuffer.getWidth() != viewport.getWidth() || frameBuffer.getHeight() != viewport.getHeight()) {
+        frameBuffer.resize(viewport.getWidth(), viewport.getHeight());
+    }
+
+    // 셀 값(0~9)별 색상 쌍 번호를 한 번만 계산
+    short colorPairs[10] = {0};
+    bool useColor = colorManager && colorManager->hasColorSupport();
+    if (useColor) {
+        for (int value = 0; value < 10; value++) {
+            colorPairs[value] = static_cast<short>(colorManager->getColorPair(getColorType(value)));
+        }
+    }
+
+    // 이번 프레임 작성 (보이는 칸만, 화면 좌표 = 맵 좌표 - 카메라 위치)
+    int originX = viewport.getX();
+    int originY = viewport.getY();
+    for (int y = 0; y < viewport.getHeight(); y++) {
+        for (int x = 0; x < viewport.getWidth(); x++) {
+            int cellValue = map.getCellUnchecked(originX + x, originY + y);
+            short colorPair = cellValue < 10 ? colorPairs[cellValue] : 0;
+            frameBuffer.setCell(x, y, getGlyph(cellValue), colorPair);
+        }
+    }
+
+    // 바뀐 칸만 출력 (묶음마다 속성을 한 번만 설정)
+    runs.clear();
+    frameBuffer.diff(runs);
+    for (const auto& run : runs) {
+        attrset(run.colorPair > 0 ? COLOR_PAIR(run.colorPair) : A_NORMAL);
+        mvaddnstr(run.y, run.x, run.text.c_str(), static_cast<int>(run.text.size()));
+    }
+    attrset(A_NORMAL);
+}
+
+char MapRenderer::getGlyph(int cellValue) {
+    switch (cellValue) {
+        case 0:  // 빈 공간
+            return ' ';
+        case 1:  // Wall
+            return '#';
+        case 2:  // Immune Wall
+            return '*';
+        case 3:  // Snake Head
+            return '@';
+        case 4:  // Snake Body
+            return 'o';
+        case 5:  // Growth Item
+            return '+';
+        case 6:  // Poison Item
+            return '-';
+        case 7:  // Gate
+            return 'G';
+        case 8:  // Speed Item
+            return '*';
+        case 9:  // Temporary Wall
+            return 'T';
+        default:
+            return '?';
+    }
+}
+
+ColorType MapRenderer::getColorType(int cellValue) {
+    switch (cellValue) {
+        case 1:  // Wall
+            return ColorType::WALL;
+        case 2:  // Immune Wall
+            return ColorType::IMMUNE_WALL;
+        case 3:  // Snake Head
+            return ColorType::SNAKE_HEAD;
+        case 4:  // Snake Body
+            return ColorType::SNAKE_BODY;
+        case 5:  // Growth Item
+            return ColorType::GROWTH_ITEM;
+        case 6:  // Poison Item
+            return ColorType::POISON_ITEM;
+        case 7:  // Gate
+            return ColorType::GATE;
+        case 8:  // Speed Item
+            return ColorType::SPEED_ITEM;
+        case 9:  // Temporary Wall
+            return ColorType::WALL;  // 일반 벽과 같은 색상 사용
+        default:
+            return ColorType::DEFAULT;
+    }
+}
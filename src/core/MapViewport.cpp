@@ -0,0 +1,31 @@
+#include "MapViewport.hpp"
+#include <algorithm>
+
+// static 멤버 변수 정의
+const int MapViewport::EDGE_MARGIN = 5;
+
+MapViewport::MapViewport() : screenColumns(0), screenRows(0), x(0), y(0), width(0), height(0) {
+}
+
+void MapViewport::setScreenSize(int columns, int rows) {
+    screenColumns = columns;
+    screenRows = rows;
+}
+
+void MapViewport::follow(int mapWidth, int mapHeight, int focusX, int focusY) {
+    width = screenColumns > 0 ? std::min(mapWidth, screenColumns) : mapWidth;
+    height = screenRows > 0 ? std::min(mapHeight, screenRows) : mapHeight;
+    x = followAxis(x, focusX, mapWidth, width);
+    y = followAxis(y, focusY, mapHeight, height);
+}
+
+int MapViewport::followAxis(int origin, int focus, int mapSize, int viewSize) {
+    if (viewSize >= mapSize) {
+        return 0;
+    }
+    int margin = std::min(EDGE_MARGIN, (viewSize - 1) / 2);
+    if (focus < origin + margin || focus > origin + viewSize - 1 - margin) {
+        origin = focus - viewSize / 2;
+    }
+    return std::clamp(origin, 0, mapSize - viewSize);
+}
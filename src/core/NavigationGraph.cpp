@@ -0,0 +1,41 @@
+#include "NavigationGraph.hpp"
+
+namespace {
+
+const int DX[] = {0, 0, -1, 1};
+const int DY[] = {-1, 1, 0, 0};
+
+}  // namespace
+
+NavigationGraph::NavigationGraph(const Simulation& simulation)
+    : map(simulation.getMap()), width(map.getWidth()), height(map.getHeight()) {
+    const GateManager& gateManager = simulation.getGateManager();
+    for (const TeleportEdge& edge : gateManager.getTeleportEdges()) {
+        auto exit = gateManager.resolveTeleportExit(edge);
+        if (exit.has_value()) {
+            teleports.push_back({edge.from.y * width + edge.from.x, static_cast<int>(edge.entryDirection),
+                                 exit->y * width + exit->x});
+        }
+    }
+}
+
+int NavigationGraph::step(int index, int direction) const {
+    int nx = index % width + DX[direction];
+    int ny = index / width + DY[direction];
+    if (nx < 0 || nx >= width || ny < 0 || ny >= height) {
+        return -1;
+    }
+    int next = ny * width + nx;
+    int value = map.getCellAt(next);
+    if (isPassableCell(value)) {
+        return next;
+    }
+    if (value == 7) {
+        for (const Teleport& teleport : teleports) {
+            if (teleport.from == index && teleport.direction == direction) {
+                return teleport.exit;
+            }
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,73 @@
+#include "ObservationEncoder.hpp"
+#include <cstring>
+
+// static 멤버 변수 정의
+const int ObservationEncoder::PLANE_COUNT;
+
+ObservationEncoder::ObservationEncoder(const GameMap& map, uint8_t* buffer)
+    : map(map), buffer(buffer), syncedChangeCount(0), initialized(false), lastSyncFull(false) {
+}
+
+void ObservationEncoder::sync() {
+    if (!initialized || !map.hasChangesSince(syncedChangeCount)) {
+        encodeAll();
+        return;
+    }
+
+    // 기록된 변경 셀만 다시 씀 (같은 셀이 여러 번 나와도 결과는 현재 값 기준)
+    uint64_t changeCount = map.getChangeCount();
+    for (uint64_t sequence = syncedChangeCount; sequence < changeCount; sequence++) {
+        encodeCell(map.getChangedCell(sequence));
+    }
+    syncedChangeCount = changeCount;
+    lastSyncFull = false;
+}
+
+void ObservationEncoder::encodeAll() {
+    std::memset(buffer, 0, getBufferSize());
+
+    size_t planeSize = static_cast<size_t>(map.getWidth()) * map.getHeight();
+    for (size_t index = 0; index < planeSize; index++) {
+        int plane = planeForCell(map.getCellAt(static_cast<int>(index)));
+        if (plane >= 0) {
+            buffer[plane * planeSize + index] = 1;
+        }
+    }
+
+    syncedChangeCount = map.getChangeCount();
+    initialized = true;
+    lastSyncFull = true;
+}
+
+void ObservationEncoder::encodeCell(int index) {
+    size_t planeSize = static_cast<size_t>(map.getWidth()) * map.getHeight();
+    for (int plane = 0; plane < PLANE_COUNT; plane++) {
+        buffer[plane * planeSize + index] = 0;
+    }
+    int plane = planeForCell(map.getCellAt(index));
+    if (plane >= 0) {
+        buffer[plane * planeSize + index] = 1;
+    }
+}
+
+void ObservationEncoder::encodeCrop(const GameMap& map, const Position& center, int radius, uint8_t* out) {
+    int side = 2 * radius + 1;
+    size_t planeSize = static_cast<size_t>(side) * side;
+    std::memset(out, 0, getCropBufferSize(radius));
+
+    const int outsidePlane = static_cast<int>(ObservationPlane::IMMUNE_WALL);
+
+    for (int dy = 0; dy < side; dy++) {
+        int y = center.y - radius + dy;
+        bool rowInside = y >= 0 && y < map.getHeight();
+        for (int dx = 0; dx < side; dx++) {
+            int x = center.x - radius + dx;
+            int plane = (rowInside && x >= 0 && x < map.getWidth())
+                            ? planeForCell(map.getCellUnchecked(x, y))
+                            : outsidePlane;
+            if (plane >= 0) {
+                out[plane * planeSize + dy * side + dx] = 1;
+            }
+        }
+    }
+}
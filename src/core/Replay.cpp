@@ -0,0 +1,177 @@
+#include "Replay.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+// static 멤버 변수 정의
+const uint8_t Replay::FORMAT_VERSION;
+
+namespace {
+
+const uint8_t MAGIC[4] = {'S', 'N', 'K', 'R'};
+
+bool isValidMapSize(uint64_t size) {
+    return size >= static_cast<uint64_t>(GameMap::MIN_SIZE) && size <= static_cast<uint64_t>(GameMap::MAX_SIZE);
+}
+
+}  // namespace
+
+ReplayTotals ReplayTotals::fromSimulation(const Simulation& simulation) {
+    const ScoreManager& scoreManager = simulation.getScoreManager();
+    ReplayTotals totals;
+    totals.score = scoreManager.getTotalScore();
+    totals.maxLength = scoreManager.getMaxLength();
+    totals.currentLength = scoreManager.getCurrentLength();
+    totals.gatesUsed = scoreManager.getTotalGatesUsed();
+    totals.poisonItems = scoreManager.getPoisonItemsCollected();
+    totals.stage = simulation.getStageManager().getCurrentStageNumber();
+    totals.completed = simulation.isGameCompleted();
+    return totals;
+}
+
+Replay::Replay() : Replay(0, 0, 0) {
+}
+
+Replay::Replay(int width, int height, uint64_t seed)
+    : width(width), height(height), seed(seed), tickCount(0) {
+}
+
+void Replay::recordAction(long long tick, GameAction action) {
+    if (action == GameAction::NONE) {
+        return;
+    }
+    events.push_back(ReplayEvent{tick, action});
+}
+
+void Replay::finish(const Simulation& simulation) {
+    // 마지막 입력 이후의 틱까지 포함 (기록 순서상 입력 틱을 넘을 수 없음)
+    tickCount = simulation.getClock().getTickCount();
+    if (!events.empty()) {
+        tickCount = std::max(tickCount, events.back().tick);
+    }
+    totals = ReplayTotals::fromSimulation(simulation);
+}
+
+int Replay::actionCode(GameAction action) {
+    switch (action) {
+        case GameAction::TURN_UP:    return 1;
+        case GameAction::TURN_DOWN:  return 2;
+        case GameAction::TURN_LEFT:  return 3;
+        case GameAction::TURN_RIGHT: return 4;
+        case GameAction::PLACE_WALL: return 5;
+        case GameAction::QUIT:       return 6;
+        case GameAction::NONE:       break;
+    }
+    return 0;
+}
+
+GameAction Replay::actionFromCode(int code) {
+    switch (code) {
+        case 1: return GameAction::TURN_UP;
+        case 2: return GameAction::TURN_DOWN;
+        case 3: return GameAction::TURN_LEFT;
+        case 4: return GameAction::TURN_RIGHT;
+        case 5: return GameAction::PLACE_WALL;
+        case 6: return GameAction::QUIT;
+    }
+    return GameAction::NONE;
+}
+
+std::vector<uint8_t> Replay::encode() const {
+    std::vector<uint8_t> out;
+    StateWriter writer(out);
+    writer.writeBytes(MAGIC, 4);
+    writer.writeByte(FORMAT_VERSION);
+    writer.writeVarint(static_cast<uint64_t>(width));
+    writer.writeVarint(static_cast<uint64_t>(height));
+    writer.writeFixed64(seed);
+
+    // 행동마다 직전 기록과의 틱 차이를 함께 저장
+    long long lastTick = 0;
+    for (const ReplayEvent& event : events) {
+        writer.writeVarint((static_cast<uint64_t>(event.tick - lastTick) << 3) | actionCode(event.action));
+        lastTick = event.tick;
+    }
+    writer.writeVarint(static_cast<uint64_t>(tickCount - lastTick) << 3);
+
+    writer.writeInt(totals.score);
+    writer.writeInt(totals.maxLength);
+    writer.writeInt(totals.currentLength);
+    writer.writeInt(totals.gatesUsed);
+    writer.writeInt(totals.poisonItems);
+    writer.writeInt(totals.stage);
+    writer.writeVarint(totals.completed ? 1 : 0);
+    return out;
+}
+
+bool Replay::decode(const std::vector<uint8_t>& bytes) {
+    StateReader reader(bytes);
+    uint8_t magic[4];
+    reader.readBytes(magic, 4);
+    if (!reader.ok() || !std::equal(MAGIC, MAGIC + 4, magic) || reader.readByte() != FORMAT_VERSION) {
+        return false;
+    }
+
+    // 게임이 만들 수 있는 크기만 허용 (int로 바꾸기 전에 확인해 음수/0 크기 Simulation을 막음)
+    uint64_t savedWidth = reader.readVarint();
+    uint64_t savedHeight = reader.readVarint();
+    if (!reader.ok() || !isValidMapSize(savedWidth) || !isValidMapSize(savedHeight)) {
+        return false;
+    }
+    int newWidth = static_cast<int>(savedWidth);
+    int newHeight = static_cast<int>(savedHeight);
+    uint64_t newSeed = reader.readFixed64();
+
+    std::vector<ReplayEvent> newEvents;
+    long long tick = 0;
+    while (reader.ok()) {
+        uint64_t value = reader.readVarint();
+        tick += static_cast<long long>(value >> 3);
+        int code = static_cast<int>(value & 7);
+        if (code == 0) {
+            break;  // 끝 표시
+        }
+        GameAction action = actionFromCode(code);
+        if (action == GameAction::NONE) return false;
+        newEvents.push_back(ReplayEvent{tick, action});
+    }
+
+    ReplayTotals newTotals;
+    newTotals.score = reader.readInt32();
+    newTotals.maxLength = reader.readInt32();
+    newTotals.currentLength = reader.readInt32();
+    newTotals.gatesUsed = reader.readInt32();
+    newTotals.poisonItems = reader.readInt32();
+    newTotals.stage = reader.readInt32();
+    newTotals.completed = reader.readVarint() != 0;
+    if (!reader.ok()) {
+        return false;
+    }
+
+    width = newWidth;
+    height = newHeight;
+    seed = newSeed;
+    tickCount = tick;
+    events = std::move(newEvents);
+    totals = newTotals;
+    return true;
+}
+
+bool Replay::saveToFile(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::vector<uint8_t> bytes = encode();
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return file.good();
+}
+
+bool Replay::loadFromFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return decode(bytes);
+}
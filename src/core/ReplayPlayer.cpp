@@ -0,0 +1,46 @@
+#include "ReplayPlayer.hpp"
+
+ReplayPlayer::ReplayPlayer(const Replay& replay)
+    : replay(replay), simulation(replay.getWidth(), replay.getHeight(), replay.getSeed()), nextEvent(0) {
+}
+
+bool ReplayPlayer::isFinished() const {
+    return simulation.isGameOver() || simulation.getClock().getTickCount() >= replay.getTickCount();
+}
+
+void ReplayPlayer::applyEventsForCurrentTick() {
+    // 기록 당시와 같은 순서로 이번 틱 이전 입력을 모두 적용
+    const auto& events = replay.getEvents();
+    long long tick = simulation.getClock().getTickCount();
+    while (nextEvent < events.size() && events[nextEvent].tick <= tick) {
+        simulation.applyAction(events[nextEvent].action);
+        nextEvent++;
+    }
+}
+
+bool ReplayPlayer::step() {
+    applyEventsForCurrentTick();
+    if (isFinished()) {
+        return false;
+    }
+    simulation.update();
+    return true;
+}
+
+ReplayResult ReplayPlayer::playToEnd() {
+    while (step()) {
+    }
+    // 마지막 틱 이후 입력 (예: 종료 키)
+    applyEventsForCurrentTick();
+
+    ReplayResult result;
+    result.totals = ReplayTotals::fromSimulation(simulation);
+    result.ticks = simulation.getClock().getTickCount();
+    result.matchesRecording = result.ticks == replay.getTickCount() && result.totals == replay.getTotals();
+    return result;
+}
+
+ReplayResult ReplayPlayer::play(const Replay& replay) {
+    ReplayPlayer player(replay);
+    return player.playToEnd();
+}
@@ -0,0 +1,636 @@
+#include "Simulation.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+#include "Stage.hpp"
+#include "TickProfiler.hpp"
+
+// static 멤버 변수 정의
+const int Simulation::baseTickDuration;
+const int Simulation::minTickDuration;
+const uint8_t Simulation::SNAPSHOT_VERSION;
+
+namespace {
+
+const uint8_t SNAPSHOT_MAGIC[4] = {'S', 'N', 'K', 'S'};
+const size_t CHECKSUM_SIZE = 8;
+
+}  // namespace
+
+Simulation::Simulation(int width, int height)
+    : Simulation(width, height, GameRng::randomSeed()) {
+}
+
+Simulation::Simulation(int width, int height, uint64_t seed)
+    : map(width, height), snake(width/2, height/2), itemManager(map, clock), gateManager(map, clock),
+      temporaryWallManager(map, clock), gameOver(false), gameCompleted(false),
+      seed(seed), rng(GameRng(seed).split(0)),
+      currentTickDuration(baseTickDuration), speedBoostCount(0),
+      temporaryWallCreationInterval(20000),  // 20초 간격
+      mapVerificationEnabled(false), mapMismatchCount(0) {
+    startGame();
+}
+
+void Simulation::reset(uint64_t newSeed) {
+    // 생성자와 같은 초기 상태를 만들되 맵/뱀/매니저의 버퍼는 재사용
+    seed = newSeed;
+    clock.reset();
+    itemManager.clear();
+    gateManager.clear();
+    temporaryWallManager.clear();
+    map.reset();
+    snake.reset(map.getWidth() / 2, map.getHeight() / 2);
+    scoreManager.reset();
+    stageManager.resetGame();
+    gameOver = false;
+    gameCompleted = false;
+    resetSpeed();
+    mapMismatchCount = 0;
+    startGame();
+}
+
+void Simulation::startGame() {
+    // 매니저마다 게임 시드에서 갈라진 독립 스트림 사용
+    GameRng root(seed);
+    rng = root.split(0);
+    itemManager.setRandomStream(root.split(1));
+    gateManager.setRandomStream(root.split(2));
+
+    // ScoreManager 초기화
+    scoreManager.updateSnakeLength(snake.getLength());
+    scoreManager.updateGameTime(clock.now());
+    scoreManager.setGameStartTime();  // 게임 시작 시간 설정
+
+    // StageManager 초기화 및 첫 번째 스테이지 맵 적용
+    stageManager.applyCurrentStageToMap(map);
+
+    // 자동 생성 타이머 초기화 (게임 시작 시 즉시 생성 가능하도록)
+    lastTemporaryWallCreation = clock.now() - temporaryWallCreationInterval;
+
+    // 첫 틱 전에도 맵에 뱀이 보이도록 반영 (빈 셀 인덱스 상태도 시드만으로 결정됨)
+    updateMap();
+}
+
+Simulation::Simulation(const Simulation& other)
+    : clock(other.clock), map(other.map), snake(other.snake),
+      itemManager(other.itemManager, map, clock), gateManager(other.gateManager, map, clock),
+      temporaryWallManager(other.temporaryWallManager, map, clock),
+      scoreManager(other.scoreManager), stageManager(other.stageManager),
+      gameOver(other.gameOver), gameCompleted(other.gameCompleted), seed(other.seed), rng(other.rng),
+      currentTickDuration(other.currentTickDuration), speedBoostCount(other.speedBoostCount),
+      lastTemporaryWallCreation(other.lastTemporaryWallCreation),
+      temporaryWallCreationInterval(other.temporaryWallCreationInterval),
+      mapVerificationEnabled(other.mapVerificationEnabled), mapMismatchCount(other.mapMismatchCount) {
+}
+
+std::unique_ptr<Simulation> Simulation::fork() const {
+    return std::unique_ptr<Simulation>(new Simulation(*this));
+}
+
+Simulation::~Simulation() {
+    // 자동으로 메모리 해제
+}
+
+void Simulation::update() {
+    if (gameOver) return;
+
+    // 게임 시계 진행 (한 틱)
+    clock.advance(std::chrono::milliseconds(currentTickDuration));
+    scoreManager.updateGameTime(clock.now());
+
+    // Snake 이동
+    {
+        SNAKE_PROFILE_PHASE(SNAKE_MOVE);
+        snake.move();
+    }
+
+    // Gate 관리
+    {
+        SNAKE_PROFILE_PHASE(GATES);
+        gateManager.removeExpiredGates();
+        gateManager.generateGates(snake);
+    }
+
+    // Temporary Wall 관리 및 자동 생성 체크
+    {
+        SNAKE_PROFILE_PHASE(TEMPORARY_WALLS);
+        temporaryWallManager.update();
+        checkTemporaryWallCreation();
+    }
+
+    // Gate 충돌 처리 (벽 충돌 감지 이전에 처리)
+    {
+        SNAKE_PROFILE_PHASE(GATE_COLLISION);
+        handleGateCollision();
+    }
+
+    // 충돌 감지
+    {
+        SNAKE_PROFILE_PHASE(COLLISION);
+        if (checkWallCollision() || snake.checkSelfCollision()) {
+            gameOver = true;
+            return;
+        }
+    }
+
+    // 아이템 관리 및 충돌 처리
+    {
+        SNAKE_PROFILE_PHASE(ITEMS);
+        itemManager.removeExpiredItems();
+        itemManager.generateItems(snake);
+        handleItemCollision();
+    }
+
+    completeTick();
+}
+
+void Simulation::completeTick() {
+    // Snake 길이 업데이트 및 스테이지 완료 확인
+    {
+        SNAKE_PROFILE_PHASE(SCORE_AND_STAGE);
+        scoreManager.updateSnakeLength(snake.getLength());
+        checkStageCompletion();
+    }
+
+    // 맵 업데이트
+    {
+        SNAKE_PROFILE_PHASE(UPDATE_MAP);
+        updateMap();
+    }
+}
+
+bool Simulation::hasScheduledWork() const {
+    if (gameOver) return true;
+
+    // 다음 update()가 진행할 시각 기준으로 각 매니저의 만료/생성 예정 확인
+    auto next = clock.now() + std::chrono::milliseconds(currentTickDuration);
+    return itemManager.hasPendingWork(next) || gateManager.hasPendingWork(next) ||
+           temporaryWallManager.hasPendingWork(next) ||
+           next - lastTemporaryWallCreation >= temporaryWallCreationInterval;
+}
+
+void Simulation::applyAction(GameAction action) {
+    switch (action) {
+        case GameAction::TURN_UP:
+            snake.setDirection(Direction::UP);
+            break;
+        case GameAction::TURN_DOWN:
+            snake.setDirection(Direction::DOWN);
+            break;
+        case GameAction::TURN_LEFT:
+            snake.setDirection(Direction::LEFT);
+            break;
+        case GameAction::TURN_RIGHT:
+            snake.setDirection(Direction::RIGHT);
+            break;
+        case GameAction::PLACE_WALL:
+            // Temporary Wall 생성 (뱀 머리 주변에)
+            createTemporaryWallAroundSnake();
+            break;
+        case GameAction::QUIT:
+            gameOver = true;
+            break;
+        case GameAction::NONE:
+            break;
+    }
+}
+
+void Simulation::saveSnapshot(std::vector<uint8_t>& out) const {
+    out.clear();
+    StateWriter writer(out);
+    writer.writeBytes(SNAPSHOT_MAGIC, 4);
+    writer.writeByte(SNAPSHOT_VERSION);
+    writer.writeVarint(static_cast<uint64_t>(map.getWidth()));
+    writer.writeVarint(static_cast<uint64_t>(map.getHeight()));
+    size_t checksumPos = writer.size();
+    writer.writeFixed64(0);  // 본문을 쓴 뒤 채움
+    size_t bodyPos = writer.size();
+
+    writer.writeFixed64(seed);
+    clock.saveState(writer);
+    map.saveState(writer);
+    snake.saveState(writer);
+    itemManager.saveState(writer);
+    gateManager.saveState(writer);
+    temporaryWallManager.saveState(writer);
+    scoreManager.saveState(writer);
+    stageManager.saveState(writer);
+    rng.saveState(writer);
+    writer.writeBool(gameOver);
+    writer.writeBool(gameCompleted);
+    writer.writeInt(currentTickDuration);
+    writer.writeInt(speedBoostCount);
+    writer.writeInt(lastTemporaryWallCreation.time_since_epoch().count());
+    writer.writeInt(temporaryWallCreationInterval.count());
+
+    uint64_t checksum = stateChecksum(out.data() + bodyPos, out.size() - bodyPos);
+    for (size_t i = 0; i < CHECKSUM_SIZE; i++) {
+        out[checksumPos + i] = static_cast<uint8_t>(checksum >> (8 * i));
+    }
+}
+
+std::vector<uint8_t> Simulation::saveSnapshot() const {
+    std::vector<uint8_t> out;
+    saveSnapshot(out);
+    return out;
+}
+
+bool Simulation::restoreSnapshot(const std::vector<uint8_t>& bytes) {
+    // 적용 전에 머리와 검사합을 모두 확인 (손상된 데이터로 반쯤 복원되는 일이 없도록)
+    StateReader reader(bytes);
+    uint8_t magic[4];
+    reader.readBytes(magic, 4);
+    uint8_t version = reader.readByte();
+    uint64_t width = reader.readVarint();
+    uint64_t height = reader.readVarint();
+    uint64_t checksum = reader.readFixed64();
+    if (!reader.ok() || !std::equal(magic, magic + 4, SNAPSHOT_MAGIC) || version != SNAPSHOT_VERSION ||
+        width != static_cast<uint64_t>(map.getWidth()) || height != static_cast<uint64_t>(map.getHeight()) ||
+        stateChecksum(reader.current(), reader.remaining()) != checksum) {
+        return false;
+    }
+
+    // 본문은 포크한 복사본에 읽고 끝까지 유효할 때만 바꿔 끼움
+    // (검사합이 맞아도 좌표가 맵 밖이거나 길이가 어긋난 본문이면 이 게임은 그대로)
+    std::unique_ptr<Simulation> scratch = fork();
+    if (!scratch->loadSnapshotBody(reader)) {
+        return false;
+    }
+    swapState(*scratch);
+    return true;
+}
+
+bool Simulation::loadSnapshotBody(StateReader& reader) {
+    seed = reader.readFixed64();
+    clock.loadState(reader);
+    map.loadState(reader);
+    snake.loadState(reader, map.getWidth(), map.getHeight());
+    itemManager.loadState(reader);
+    gateManager.loadState(reader);
+    temporaryWallManager.loadState(reader);
+    scoreManager.loadState(reader);
+    stageManager.loadState(reader);
+    rng.loadState(reader);
+    gameOver = reader.readBool();
+    gameCompleted = reader.readBool();
+    currentTickDuration = reader.readInt32();
+    speedBoostCount = reader.readInt32();
+    lastTemporaryWallCreation = GameClock::time_point(GameClock::duration(reader.readInt()));
+    temporaryWallCreationInterval = std::chrono::milliseconds(reader.readInt());
+    // 틱 지속시간 0은 고정 틱 스케줄러의 나눗셈을, 간격 0 이하는 매 틱 벽 생성을 일으킴
+    if (currentTickDuration < minTickDuration || currentTickDuration > baseTickDuration ||
+        speedBoostCount < 0 || temporaryWallCreationInterval.count() <= 0) {
+        reader.fail();
+    }
+    return reader.ok() && reader.atEnd();
+}
+
+void Simulation::swapState(Simulation& other) {
+    std::swap(seed, other.seed);
+    std::swap(clock, other.clock);
+    std::swap(map, other.map);
+    std::swap(snake, other.snake);
+    itemManager.swapState(other.itemManager);
+    gateManager.swapState(other.gateManager);
+    temporaryWallManager.swapState(other.temporaryWallManager);
+    std::swap(scoreManager, other.scoreManager);
+    std::swap(stageManager, other.stageManager);
+    std::swap(rng, other.rng);
+    std::swap(gameOver, other.gameOver);
+    std::swap(gameCompleted, other.gameCompleted);
+    std::swap(currentTickDuration, other.currentTickDuration);
+    std::swap(speedBoostCount, other.speedBoostCount);
+    std::swap(lastTemporaryWallCreation, other.lastTemporaryWallCreation);
+    std::swap(temporaryWallCreationInterval, other.temporaryWallCreationInterval);
+}
+
+bool Simulation::checkWallCollision() const {
+    int headX = snake.getHeadX();
+    int headY = snake.getHeadY();
+
+    // 맵 경계 확인
+    if (headX < 0 || headX >= map.getWidth() ||
+        headY < 0 || headY >= map.getHeight()) {
+        return true;
+    }
+
+    // 벽과의 충돌 확인 (게이트는 제외)
+    int cellValue = map.getCellValue(headX, headY);
+    return cellValue == 1 || cellValue == 2 || cellValue == 9;  // Wall, Immune Wall, Temporary Wall 충돌
+}
+
+void Simulation::updateMap() {
+    // Snake가 바꾼 셀을 맵의 변경 목록에 합침
+    for (const auto& pos : snake.getChangedCells()) {
+        map.markDirty(pos.x, pos.y);
+    }
+    snake.clearChangedCells();
+
+    if (map.isAllDirty()) {
+        // 스테이지 적용 등으로 맵 전체가 바뀐 경우
+        rebuildMap();
+    } else {
+        // 보통은 머리/꼬리 등 몇 개 셀만 바뀜
+        int stride = map.getStride();
+        for (int index : map.getDirtyCells()) {
+            int x = index % stride;
+            int y = index / stride;
+            map.setCellUnchecked(x, y, resolveCell(x, y));
+        }
+
+        if (mapVerificationEnabled) {
+            verifyMap();
+        }
+    }
+
+    map.clearDirty();
+}
+
+uint8_t Simulation::resolveCell(int x, int y) const {
+    // rebuildMap()과 같은 우선순위: 지형 < 아이템 < Gate < Temporary Wall < 몸통 < 머리
+    uint8_t current = map.getCellUnchecked(x, y);
+    uint8_t value = (current == 1 || current == 2) ? current : 0;
+
+    int itemValue = itemManager.getCellValueAt(x, y);
+    if (itemValue != 0) {
+        value = static_cast<uint8_t>(itemValue);
+    }
+    if (gateManager.hasGateAt(x, y)) {
+        value = 7;
+    }
+    if (temporaryWallManager.hasTemporaryWallAt(Position(x, y))) {
+        value = 9;
+    }
+    if (snake.isOccupied(x, y)) {
+        value = (snake.getHead() == Position(x, y)) ? 3 : 4;
+    }
+    return value;
+}
+
+void Simulation::verifyMap() {
+    // 증분 결과를 보관한 뒤 전체 재구성 결과와 비교 (재구성 결과를 최종 값으로 사용)
+    std::vector<uint8_t> incremental(static_cast<size_t>(map.getStride()) * map.getHeight());
+    map.copyCellsTo(incremental.data());
+    rebuildMap();
+
+    for (size_t i = 0; i < incremental.size(); i++) {
+        if (incremental[i] != map.getCellAt(static_cast<int>(i))) {
+            mapMismatchCount++;
+        }
+    }
+}
+
+void Simulation::rebuildMap() {
+    // 맵 초기화 (벽 제외하고 모든 내부 셀을 0으로)
+    for (int y = 1; y < map.getHeight() - 1; y++) {
+        for (int x = 1; x < map.getWidth() - 1; x++) {
+            uint8_t cellValue = map.getCellUnchecked(x, y);
+            if (cellValue != 1 && cellValue != 2) {
+                map.setCellUnchecked(x, y, 0);
+            }
+        }
+    }
+
+    // 아이템 위치 업데이트
+    itemManager.updateMap();
+
+    // Gate 위치 업데이트
+    gateManager.updateMap();
+
+    // Temporary Wall 위치 업데이트
+    temporaryWallManager.updateMap();
+
+    // Snake 위치 업데이트
+    const auto& body = snake.getBody();
+    for (size_t i = 0; i < body.size(); i++) {
+        int x = body[i].x;
+        int y = body[i].y;
+
+        if (map.isValidPosition(x, y)) {
+            if (i == 0) {
+                map.setSnakeHead(x, y);  // 머리
+            } else {
+                map.setSnakeBody(x, y);  // 몸통
+            }
+        }
+    }
+}
+
+void Simulation::handleItemCollision() {
+    auto collectedItem = itemManager.checkCollision(snake);
+    if (collectedItem.has_value()) {
+        switch (collectedItem->getType()) {
+            case ItemType::GROWTH:
+                snake.applyGrowthItem();
+                break;
+            case ItemType::POISON:
+                if (!snake.applyPoisonItem()) {
+                    // 길이가 최소값 미만이 되면 게임 오버
+                    gameOver = true;
+                    return;
+                }
+                break;
+            case ItemType::SPEED:
+                break;
+        }
+        recordItemCollected(collectedItem->getType());
+    }
+}
+
+void Simulation::recordItemCollected(ItemType type) {
+    switch (type) {
+        case ItemType::GROWTH:
+            scoreManager.incrementGrowthItems();
+            // 미션 진행상황 업데이트
+            stageManager.updateMissionProgress(MissionType::GROWTH_ITEMS, scoreManager.getGrowthItemsCollected());
+            break;
+        case ItemType::POISON:
+            scoreManager.incrementPoisonItems();
+            break;
+        case ItemType::SPEED:
+            // 속도 부스트 적용
+            applySpeedBoost();
+            // TODO: ScoreManager에 SPEED 아이템 카운터 추가 시 여기서 증가
+            break;
+    }
+}
+
+void Simulation::handleGateCollision() {
+    auto collisionGate = gateManager.checkCollision(snake);
+    if (collisionGate.has_value()) {
+        Position gatePos = collisionGate->getPosition();
+
+        // Snake가 Gate에 진입 중임을 표시
+        gateManager.setSnakeEntering(gatePos, true);
+
+        // 새로운 진출 방향 계산 로직 적용
+        Position exitPos;
+        Direction exitDirection;
+
+        if (collisionGate->isOuterWall()) {
+            // 외부벽 Gate: 고정 방향으로 진출
+            exitDirection = gateManager.calculateOuterWallExitDirection(gatePos, snake.getDirection());
+        } else {
+            // 내부벽 Gate: 우선순위에 따른 방향 결정
+            auto priorities = gateManager.calculateInnerWallDirectionPriority(gatePos, snake.getDirection());
+            exitDirection = priorities[0];  // 첫 번째 우선순위 방향 사용
+
+            // 특별 규칙 적용 (요구사항에 따라)
+            // 여기서는 기본 우선순위를 사용하지만, 필요시 특별 규칙 적용 가능
+        }
+
+        // 양방향 텔레포트 처리 (기존 로직 유지)
+        exitPos = gateManager.calculateBidirectionalExitPosition(*collisionGate, exitDirection, snake);
+
+        if (exitPos.x != -1 && exitPos.y != -1) {
+            snake.teleportTo(exitPos);
+            scoreManager.incrementGatesUsed();
+            // 미션 진행상황 업데이트
+            stageManager.updateMissionProgress(MissionType::GATES, scoreManager.getGatesUsed());
+        }
+
+        // 텔레포트 완료 후 진입 상태 해제
+        gateManager.setSnakeEntering(gatePos, false);
+    }
+}
+
+void Simulation::checkStageCompletion() {
+    if (stageManager.isCurrentStageCompleted()) {
+        if (stageManager.isLastStage()) {
+            // 게임 완료 - 별도 플래그 설정
+            gameCompleted = true;
+            gameOver = true;
+        } else {
+            // 다음 스테이지로 이동
+            stageManager.nextStage();
+            stageManager.applyCurrentStageToMap(map);
+            map.markAllDirty();
+
+            // 스테이지별 카운터 초기화 (Growth Items, Gates 사용 횟수)
+            scoreManager.resetStageSpecificCounters();
+
+            // Temporary Wall 초기화
+            temporaryWallManager.clear();
+
+            // 뱀을 안전한 위치로 초기화
+            auto safePos = map.findSafePosition();
+            if (safePos.has_value()) {
+                snake.reset(safePos.value().first, safePos.value().second);
+            } else {
+                // 안전한 위치를 찾지 못한 경우 기본 위치로 초기화
+                snake.reset(10, 10);
+            }
+        }
+    }
+}
+
+// 속도 관리 메서드들
+void Simulation::applySpeedBoost() {
+    speedBoostCount++;
+
+    // 새로운 속도 계산: baseTickDuration / (1 + speedBoostCount * 0.2)
+    double speedMultiplier = 1.0 + speedBoostCount * 0.2;
+    int newTickDuration = static_cast<int>(baseTickDuration / speedMultiplier);
+
+    // 최소 속도 제한 적용
+    currentTickDuration = std::max(newTickDuration, minTickDuration);
+}
+
+void Simulation::resetSpeed() {
+    currentTickDuration = baseTickDuration;
+    speedBoostCount = 0;
+}
+
+void Simulation::createTemporaryWallAroundSnake() {
+    Position headPos = snake.getHead();
+    auto lifetime = std::chrono::milliseconds(5000);  // 5초 생존
+
+    // 뱀 머리 주변 8방향에 Temporary Wall 생성
+    std::vector<Position> positions = {
+        {headPos.x - 1, headPos.y - 1}, // 좌상
+        {headPos.x, headPos.y - 1},     // 상
+        {headPos.x + 1, headPos.y - 1}, // 우상
+        {headPos.x - 1, headPos.y},     // 좌
+        {headPos.x + 1, headPos.y},     // 우
+        {headPos.x - 1, headPos.y + 1}, // 좌하
+        {headPos.x, headPos.y + 1},     // 하
+        {headPos.x + 1, headPos.y + 1}  // 우하
+    };
+
+    for (const auto& pos : positions) {
+        // 유효한 위치이고 빈 공간인 경우에만 Temporary Wall 생성
+        if (map.isValidPosition(pos.x, pos.y) && map.getCellValue(pos.x, pos.y) == 0) {
+            temporaryWallManager.addTemporaryWall(pos, lifetime);
+        }
+    }
+}
+
+void Simulation::checkTemporaryWallCreation() {
+    auto now = clock.now();
+    auto elapsed = now - lastTemporaryWallCreation;
+
+    // 설정된 간격이 지났으면 자동 생성
+    if (elapsed >= temporaryWallCreationInterval) {
+        createRandomTemporaryWalls();
+        lastTemporaryWallCreation = now;
+    }
+}
+
+void Simulation::createRandomTemporaryWalls() {
+    auto lifetime = std::chrono::milliseconds(5000);  // 5초 생존
+    const int wallsToCreate = 2;  // 한 번에 2개 생성
+    const int maxAttempts = 16;   // 무작위 추출 재시도 횟수
+
+    int freeCount = map.getFreeCellCount();
+    if (freeCount == 0) {
+        return;
+    }
+
+    // 맵이 유지하는 빈 셀 목록에서 균등 추출 (맵 전체를 훑지 않으므로 맵 크기와 무관)
+    Position chosen[wallsToCreate];
+    int created = 0;
+    for (int attempts = 0; attempts < maxAttempts && created < wallsToCreate; attempts++) {
+        auto [x, y] = map.getFreeCell(rng.uniformInt(freeCount));
+        Position candidate(x, y);
+        if (std::find(chosen, chosen + created, candidate) == chosen + created &&
+            isTemporaryWallCandidate(x, y)) {
+            chosen[created++] = candidate;
+        }
+    }
+
+    // 재시도가 모두 실패하면 (뱀 주변 외에 빈 칸이 거의 없음) 임의의 위치부터 빈 셀 목록을 한 바퀴 순회
+    if (created < wallsToCreate) {
+        int start = rng.uniformInt(freeCount);
+        for (int i = 0; i < freeCount && created < wallsToCreate; i++) {
+            auto [x, y] = map.getFreeCell((start + i) % freeCount);
+            Position candidate(x, y);
+            if (std::find(chosen, chosen + created, candidate) == chosen + created &&
+                isTemporaryWallCandidate(x, y)) {
+                chosen[created++] = candidate;
+            }
+        }
+    }
+
+    for (int i = 0; i < created; i++) {
+        temporaryWallManager.addTemporaryWall(chosen[i], lifetime);
+    }
+}
+
+bool Simulation::isTemporaryWallCandidate(int x, int y) const {
+    const int minDistance = 3;  // 뱀과의 최소 거리
+    if (map.getCellValue(x, y) != 0) {
+        return false;
+    }
+
+    // 뱀(머리 포함 몸통 전체)과의 맨하탄 거리가 minDistance 이상인지 확인
+    // 마디를 모두 훑는 대신 minDistance 미만 마름모 이웃의 점유 여부만 조회
+    for (int dy = -(minDistance - 1); dy <= minDistance - 1; dy++) {
+        int span = minDistance - 1 - abs(dy);
+        for (int dx = -span; dx <= span; dx++) {
+            if (snake.isOccupied(x + dx, y + dy)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,105 @@
+#include "StateStream.hpp"
+#include <climits>
+#include <cstring>
+
+void StateWriter::writeVarint(uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void StateWriter::writeInt(int64_t value) {
+    // 음수도 짧게 저장 (zigzag)
+    writeVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+void StateWriter::writeFixed64(uint64_t value) {
+    for (int i = 0; i < 8; i++) {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+uint8_t StateReader::readByte() {
+    if (failed || pos >= size) {
+        failed = true;
+        return 0;
+    }
+    return data[pos++];
+}
+
+bool StateReader::readBytes(uint8_t* dest, size_t count) {
+    if (failed || count > size - pos) {
+        failed = true;
+        return false;
+    }
+    std::memcpy(dest, data + pos, count);
+    pos += count;
+    return true;
+}
+
+bool StateReader::skip(size_t count) {
+    if (failed || count > size - pos) {
+        failed = true;
+        return false;
+    }
+    pos += count;
+    return true;
+}
+
+uint64_t StateReader::readVarint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t byte = readByte();
+        if (failed) {
+            return 0;
+        }
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    failed = true;
+    return 0;
+}
+
+int64_t StateReader::readInt() {
+    uint64_t value = readVarint();
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+int StateReader::readInt32() {
+    int64_t value = readInt();
+    if (value < INT_MIN || value > INT_MAX) {
+        failed = true;
+        return 0;
+    }
+    return static_cast<int>(value);
+}
+
+uint64_t StateReader::readFixed64() {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) {
+        value |= static_cast<uint64_t>(readByte()) << (8 * i);
+    }
+    return failed ? 0 : value;
+}
+
+size_t StateReader::readCount(size_t maxCount) {
+    uint64_t count = readVarint();
+    if (count > maxCount) {
+        failed = true;
+        return 0;
+    }
+    return static_cast<size_t>(count);
+}
+
+uint64_t stateChecksum(const uint8_t* data, size_t size) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
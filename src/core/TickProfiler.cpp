@@ -0,0 +1,60 @@
+#include "TickProfiler.hpp"
+#include <cstdio>
+
+// static 멤버 변수 정의
+const int TickProfiler::PHASE_COUNT;
+
+TickProfiler::TickProfiler() {
+}
+
+TickProfiler& TickProfiler::current() {
+    static thread_local TickProfiler profiler;
+    return profiler;
+}
+
+void TickProfiler::merge(const TickProfiler& other) {
+    for (int i = 0; i < PHASE_COUNT; i++) {
+        histograms[i].merge(other.histograms[i]);
+    }
+}
+
+void TickProfiler::reset() {
+    for (auto& histogram : histograms) {
+        histogram.reset();
+    }
+}
+
+void TickProfiler::writeReport(std::ostream& out) const {
+    char line[128];
+    std::snprintf(line, sizeof(line), "%-16s %10s %10s %10s %10s %10s\n",
+                  "phase (us)", "count", "p50", "p99", "p999", "max");
+    out << line;
+
+    for (int i = 0; i < PHASE_COUNT; i++) {
+        const LatencyHistogram& histogram = histograms[i];
+        std::snprintf(line, sizeof(line), "%-16s %10llu %10.1f %10.1f %10.1f %10.1f\n",
+                      getPhaseName(static_cast<ProfilePhase>(i)),
+                      static_cast<unsigned long long>(histogram.getCount()),
+                      histogram.percentile(0.5) / 1000.0,
+                      histogram.percentile(0.99) / 1000.0,
+                      histogram.percentile(0.999) / 1000.0,
+                      histogram.getMax() / 1000.0);
+        out << line;
+    }
+}
+
+const char* TickProfiler::getPhaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::SNAKE_MOVE:      return "snake_move";
+        case ProfilePhase::GATES:           return "gates";
+        case ProfilePhase::TEMPORARY_WALLS: return "temporary_walls";
+        case ProfilePhase::GATE_COLLISION:  return "gate_collision";
+        case ProfilePhase::COLLISION:       return "collision";
+        case ProfilePhase::ITEMS:           return "items";
+        case ProfilePhase::SCORE_AND_STAGE: return "score_stage";
+        case ProfilePhase::UPDATE_MAP:      return "update_map";
+        case ProfilePhase::DRAW:            return "draw";
+        case ProfilePhase::COUNT:           break;
+    }
+    return "unknown";
+}
@@ -0,0 +1,415 @@
+#include "VecSnakeEnv.hpp"
+#include "GameRng.hpp"
+#include <algorithm>
+#include <chrono>
+
+// static 멤버 변수 정의
+constexpr float VecSnakeEnv::REWARD_PER_LENGTH;
+constexpr float VecSnakeEnv::REWARD_PER_GATE;
+constexpr float VecSnakeEnv::REWARD_STAGE_CLEAR;
+constexpr float VecSnakeEnv::REWARD_DEATH;
+constexpr int VecSnakeEnv::MAX_STEP_CELLS;
+
+namespace {
+
+// Direction 순서(UP, DOWN, LEFT, RIGHT)별 한 칸 이동량 (반대 방향은 값 ^ 1)
+const int STEP_X[4] = {0, 0, -1, 1};
+const int STEP_Y[4] = {-1, 1, 0, 0};
+
+const int MIN_SNAKE_LENGTH = 3;  // Snake::getMinLength()
+const uint8_t GROWTH_VALUE = 5;
+const uint8_t POISON_VALUE = 6;
+const uint8_t GATE_VALUE = 7;
+
+bool isTurn(GameAction action) {
+    return action == GameAction::TURN_UP || action == GameAction::TURN_DOWN ||
+           action == GameAction::TURN_LEFT || action == GameAction::TURN_RIGHT;
+}
+
+uint8_t turnDirection(GameAction action) {
+    switch (action) {
+        case GameAction::TURN_UP:
+            return static_cast<uint8_t>(Direction::UP);
+        case GameAction::TURN_DOWN:
+            return static_cast<uint8_t>(Direction::DOWN);
+        case GameAction::TURN_LEFT:
+            return static_cast<uint8_t>(Direction::LEFT);
+        default:
+            return static_cast<uint8_t>(Direction::RIGHT);
+    }
+}
+
+// 아이템으로 늘어난 길이 (누적 Growth - Poison)
+// 스테이지 전환 때 뱀이 초기 길이로 돌아가도 줄지 않으므로 길이 보상은 이 값의 변화로 계산
+int pickupLengthGain(const ScoreManager& scoreManager) {
+    return scoreManager.getTotalGrowthItemsCollected() - scoreManager.getPoisonItemsCollected();
+}
+
+}  // namespace
+
+VecSnakeEnv::VecSnakeEnv(int envCount, int width, int height, uint64_t baseSeed, int threadCount)
+    : envCount(envCount), width(width), height(height), cellCount(width * height), baseSeed(baseSeed),
+      simulations(envCount),
+      observations(static_cast<size_t>(envCount) * width * height, 0),
+      rewards(envCount, 0.0f), dones(envCount, 0),
+      lengthGains(envCount, 0), gatesUsed(envCount, 0), stages(envCount, 0),
+      nextLengthGains(envCount, 0), nextGatesUsed(envCount, 0), nextStages(envCount, 0), completed(envCount, 0),
+      episodeCounts(envCount, 0), episodeReturns(envCount, 0.0f), lastEpisodeReturns(envCount, 0.0f),
+      bodyCapacity(1), bodyHeads(envCount, 0), bodyLengths(envCount, 0), directions(envCount, 0),
+      growing(envCount, 0), occupancy(static_cast<size_t>(envCount) * width * height, 0),
+      itemCells(static_cast<size_t>(envCount) * ItemManager::MAX_ITEMS, -1),
+      itemValues(static_cast<size_t>(envCount) * ItemManager::MAX_ITEMS, 0),
+      scheduled(envCount, 1), snakeSynced(envCount, 1),
+      stepKinds(envCount, STEP_SIMULATION), stepCells(static_cast<size_t>(envCount) * MAX_STEP_CELLS, 0),
+      stepCellCounts(envCount, 0), stepItemCells(envCount, -1), simulationStepCount(0) {
+    while (bodyCapacity < cellCount) {
+        bodyCapacity *= 2;
+    }
+    bodyCells.assign(static_cast<size_t>(envCount) * bodyCapacity, 0);
+
+    if (threadCount > 1) {
+        pool = std::make_unique<WorkStealingPool>(threadCount);
+    }
+    segmentBuffers.resize(pool ? pool->getThreadCount() : 1);
+    for (auto& buffer : segmentBuffers) {
+        buffer.reserve(bodyCapacity);
+    }
+    reset();
+}
+
+VecSnakeEnv::~VecSnakeEnv() {
+    // 자동으로 메모리 해제
+}
+
+uint64_t VecSnakeEnv::episodeSeed(uint64_t baseSeed, int env, long long episode) {
+    return GameRng(baseSeed).split(static_cast<uint64_t>(env)).split(static_cast<uint64_t>(episode)).next();
+}
+
+const Simulation& VecSnakeEnv::getSimulation(int env) {
+    syncSnakeToSimulation(env, 0);
+    return *simulations[env];
+}
+
+void VecSnakeEnv::reset() {
+    for (int env = 0; env < envCount; env++) {
+        resetEnv(env);
+        rewards[env] = 0.0f;
+        dones[env] = 0;
+        episodeReturns[env] = 0.0f;
+    }
+}
+
+void VecSnakeEnv::resetEnv(int env) {
+    // 처음만 생성하고 이후 에피소드는 같은 Simulation을 새 시드로 되돌림 (버퍼 재사용)
+    uint64_t seed = episodeSeed(baseSeed, env, episodeCounts[env]);
+    if (simulations[env]) {
+        simulations[env]->reset(seed);
+    } else {
+        simulations[env] = std::make_unique<Simulation>(width, height, seed);
+    }
+
+    const Simulation& simulation = *simulations[env];
+    loadFromSimulation(env);
+    lengthGains[env] = pickupLengthGain(simulation.getScoreManager());
+    gatesUsed[env] = simulation.getScoreManager().getTotalGatesUsed();
+    stages[env] = simulation.getStageManager().getCurrentStageNumber();
+    scheduled[env] = simulation.hasScheduledWork() ? 1 : 0;
+}
+
+void VecSnakeEnv::step(const GameAction* actions) {
+    // 1) 배열 루프: 모든 환경의 이동 → 벽/자기 충돌 → 아이템 판정 (Simulation은 건드리지 않음)
+    for (int env = 0; env < envCount; env++) {
+        moveEnv(env, actions[env]);
+    }
+
+    // 2) 환경별 마무리: 배열 경로는 시계/점수와 바뀐 셀만 반영, 나머지는 Simulation::update
+    //    (환경끼리 공유 상태가 없으므로 병렬 실행 가능)
+    if (pool) {
+        pool->parallelFor(envCount, [this, actions](size_t env, int worker) {
+            finishEnv(static_cast<int>(env), actions[env], worker);
+        });
+    } else {
+        for (int env = 0; env < envCount; env++) {
+            finishEnv(env, actions[env], 0);
+        }
+    }
+    simulationStepCount = static_cast<int>(std::count(stepKinds.begin(), stepKinds.end(), STEP_SIMULATION));
+
+    // 3) 모은 카운터 배열로 보상/종료를 한 번에 계산 (분기 없는 배열 연산)
+    for (int env = 0; env < envCount; env++) {
+        float reward = (nextLengthGains[env] - lengthGains[env]) * REWARD_PER_LENGTH +
+                       (nextGatesUsed[env] - gatesUsed[env]) * REWARD_PER_GATE +
+                       ((nextStages[env] > stages[env]) | completed[env]) * REWARD_STAGE_CLEAR +
+                       (dones[env] & (completed[env] ^ 1)) * REWARD_DEATH;
+        rewards[env] = reward;
+        episodeReturns[env] += reward;
+        lengthGains[env] = nextLengthGains[env];
+        gatesUsed[env] = nextGatesUsed[env];
+        stages[env] = nextStages[env];
+    }
+
+    // 4) 끝난 환경은 자동 리셋 (관측은 새 에피소드의 첫 상태)
+    for (int env = 0; env < envCount; env++) {
+        if (dones[env]) {
+            lastEpisodeReturns[env] = episodeReturns[env];
+            episodeReturns[env] = 0.0f;
+            episodeCounts[env]++;
+            resetEnv(env);
+        }
+    }
+}
+
+void VecSnakeEnv::moveEnv(int env, GameAction action) {
+    stepCellCounts[env] = 0;
+
+    // 예약된 일(아이템/Gate/Temporary Wall 만료·생성)이 있는 틱과 특수 행동은 Simulation이 진행
+    bool turn = isTurn(action);
+    if (scheduled[env] || (action != GameAction::NONE && !turn)) {
+        stepKinds[env] = STEP_SIMULATION;
+        return;
+    }
+
+    // 방향 전환 (반대 방향은 무시 - Snake::setDirection과 같은 규칙)
+    if (turn) {
+        uint8_t wanted = turnDirection(action);
+        if (wanted != (directions[env] ^ 1) && wanted != directions[env]) {
+            directions[env] = wanted;
+            snakeSynced[env] = 0;
+        }
+    }
+
+    int head = bodyCells[bodyIndex(env, 0)];
+    int direction = directions[env];
+    int nextX = head % width + STEP_X[direction];
+    int nextY = head / width + STEP_Y[direction];
+    if (nextX < 0 || nextX >= width || nextY < 0 || nextY >= height) {
+        stepKinds[env] = STEP_SIMULATION;
+        return;
+    }
+    int next = nextY * width + nextX;
+    uint8_t value = observations[static_cast<size_t>(env) * cellCount + next];
+    if (value == GATE_VALUE) {
+        // Gate 통과는 Simulation이 처리
+        stepKinds[env] = STEP_SIMULATION;
+        return;
+    }
+
+    // 이번 틱에 만료되거나 새로 생기는 아이템이 없으므로 슬롯만 보면 됨
+    int* items = &itemCells[static_cast<size_t>(env) * ItemManager::MAX_ITEMS];
+    int slot = -1;
+    for (int i = 0; i < ItemManager::MAX_ITEMS; i++) {
+        if (items[i] == next) {
+            slot = i;
+        }
+    }
+
+    // 다시 쓸 셀은 Simulation::updateMap의 변경 목록 순서대로 기록
+    // (아이템 매니저의 표시 → 이전 머리, 새 머리, 꼬리 → 아이템 효과로 바뀐 꼬리)
+    int* cells = &stepCells[static_cast<size_t>(env) * MAX_STEP_CELLS];
+    int count = 0;
+    if (slot >= 0) {
+        cells[count++] = next;
+    }
+
+    // 이동 (Snake::move와 같은 순서: 새 머리 추가 후 꼬리 제거)
+    uint8_t* occupied = &occupancy[static_cast<size_t>(env) * cellCount];
+    int mask = bodyCapacity - 1;
+    cells[count++] = head;
+    bodyHeads[env] = (bodyHeads[env] - 1) & mask;
+    bodyCells[bodyIndex(env, 0)] = next;
+    bodyLengths[env]++;
+    occupied[next]++;
+    cells[count++] = next;
+    if (growing[env]) {
+        growing[env] = 0;
+    } else {
+        int tail = bodyCells[bodyIndex(env, bodyLengths[env] - 1)];
+        bodyLengths[env]--;
+        occupied[tail]--;
+        cells[count++] = tail;
+    }
+
+    // 충돌 (벽/Immune Wall/Temporary Wall, 머리 칸에 다른 마디가 겹친 경우)
+    if (value == 1 || value == 2 || value == 9 || occupied[next] > 1) {
+        stepKinds[env] = STEP_DEATH;
+        return;
+    }
+
+    if (slot < 0) {
+        stepKinds[env] = STEP_MOVE;
+        stepCellCounts[env] = static_cast<uint8_t>(count);
+        return;
+    }
+
+    // 아이템 효과 (Snake::applyGrowthItem / applyPoisonItem과 같은 규칙)
+    uint8_t itemValue = itemValues[static_cast<size_t>(env) * ItemManager::MAX_ITEMS + slot];
+    items[slot] = -1;
+    int tail = bodyCells[bodyIndex(env, bodyLengths[env] - 1)];
+    if (itemValue == GROWTH_VALUE) {
+        // 꼬리 복사로 즉시 길이 증가, 다음 이동에서 꼬리 유지
+        bodyCells[bodyIndex(env, bodyLengths[env])] = tail;
+        bodyLengths[env]++;
+        occupied[tail]++;
+        growing[env] = 1;
+        cells[count++] = tail;
+    } else if (itemValue == POISON_VALUE) {
+        if (bodyLengths[env] <= MIN_SNAKE_LENGTH) {
+            stepKinds[env] = STEP_DEATH;
+            return;
+        }
+        bodyLengths[env]--;
+        occupied[tail]--;
+        cells[count++] = tail;
+    }
+    stepKinds[env] = STEP_ITEM;
+    stepItemCells[env] = next;
+    stepCellCounts[env] = static_cast<uint8_t>(count);
+}
+
+void VecSnakeEnv::finishEnv(int env, GameAction action, int worker) {
+    Simulation& simulation = *simulations[env];
+    uint8_t kind = stepKinds[env];
+
+    if (kind == STEP_SIMULATION) {
+        syncSnakeToSimulation(env, worker);
+        simulation.applyAction(action);
+        simulation.update();
+        loadFromSimulation(env);
+    } else if (kind == STEP_MOVE || kind == STEP_ITEM) {
+        // Simulation::update 중 배열 경로가 대신하지 않은 부분 (시계, 점수, 아이템 기록)
+        GameClock& clock = simulation.getClock();
+        clock.advance(std::chrono::milliseconds(simulation.getCurrentTickDuration()));
+        simulation.getScoreManager().updateGameTime(clock.now());
+        snakeSynced[env] = 0;
+
+        bool stageCompleted = false;
+        if (kind == STEP_ITEM) {
+            int cell = stepItemCells[env];
+            auto item = simulation.getItemManager().takeItemAt(Position(cell % width, cell / width));
+            if (item.has_value()) {
+                simulation.recordItemCollected(item->getType());
+            }
+            stageCompleted = simulation.getStageManager().isCurrentStageCompleted();
+        }
+
+        if (stageCompleted) {
+            // 스테이지 전환은 Simulation이 처리 (바뀐 셀을 같은 순서로 표시한 뒤 나머지 단계 진행)
+            GameMap& map = simulation.getMap();
+            const int* cells = &stepCells[static_cast<size_t>(env) * MAX_STEP_CELLS];
+            for (int i = 0; i < stepCellCounts[env]; i++) {
+                map.markDirty(cells[i] % width, cells[i] / width);
+            }
+            syncSnakeToSimulation(env, worker);
+            simulation.completeTick();
+            loadFromSimulation(env);
+        } else {
+            simulation.getScoreManager().updateSnakeLength(bodyLengths[env]);
+            writeStepCells(env);
+        }
+    }
+
+    nextLengthGains[env] = pickupLengthGain(simulation.getScoreManager());
+    nextGatesUsed[env] = simulation.getScoreManager().getTotalGatesUsed();
+    nextStages[env] = simulation.getStageManager().getCurrentStageNumber();
+    completed[env] = simulation.isGameCompleted() ? 1 : 0;
+    dones[env] = (kind == STEP_DEATH || simulation.isGameOver()) ? 1 : 0;
+    scheduled[env] = simulation.hasScheduledWork() ? 1 : 0;
+}
+
+void VecSnakeEnv::syncSnakeToSimulation(int env, int worker) {
+    if (snakeSynced[env]) {
+        return;
+    }
+    std::vector<Position>& segments = segmentBuffers[worker];
+    segments.clear();
+    for (int i = 0; i < bodyLengths[env]; i++) {
+        int cell = bodyCells[bodyIndex(env, i)];
+        segments.emplace_back(cell % width, cell / width);
+    }
+    simulations[env]->getSnake().assignBody(segments.data(), segments.size(),
+                                            static_cast<Direction>(directions[env]), growing[env] != 0);
+    snakeSynced[env] = 1;
+}
+
+void VecSnakeEnv::loadFromSimulation(int env) {
+    const Simulation& simulation = *simulations[env];
+
+    // 뱀: 이전 마디의 점유를 지우고 Simulation의 몸통을 링 앞에서부터 다시 채움
+    uint8_t* occupied = &occupancy[static_cast<size_t>(env) * cellCount];
+    for (int i = 0; i < bodyLengths[env]; i++) {
+        occupied[bodyCells[bodyIndex(env, i)]]--;
+    }
+    const Snake& snake = simulation.getSnake();
+    int* body = &bodyCells[static_cast<size_t>(env) * bodyCapacity];
+    int length = 0;
+    for (const auto& segment : snake.getBody()) {
+        int cell = segment.y * width + segment.x;
+        body[length++] = cell;
+        occupied[cell]++;
+    }
+    bodyHeads[env] = 0;
+    bodyLengths[env] = length;
+    directions[env] = static_cast<uint8_t>(snake.getDirection());
+    growing[env] = snake.isGrowing() ? 1 : 0;
+    snakeSynced[env] = 1;
+
+    // 아이템 슬롯
+    const ItemManager& itemManager = simulation.getItemManager();
+    const auto& activeItems = itemManager.getItems();
+    int* items = &itemCells[static_cast<size_t>(env) * ItemManager::MAX_ITEMS];
+    uint8_t* values = &itemValues[static_cast<size_t>(env) * ItemManager::MAX_ITEMS];
+    for (int slot = 0; slot < ItemManager::MAX_ITEMS; slot++) {
+        if (slot < static_cast<int>(activeItems.size())) {
+            const Item& item = activeItems[slot];
+            items[slot] = item.getY() * width + item.getX();
+            values[slot] = static_cast<uint8_t>(itemManager.getCellValueAt(item.getX(), item.getY()));
+        } else {
+            items[slot] = -1;
+        }
+    }
+
+    // 관측
+    simulation.getMap().copyCellsTo(observations.data() + static_cast<size_t>(env) * cellCount);
+}
+
+void VecSnakeEnv::writeStepCells(int env) {
+    // Simulation::updateMap과 같은 순서로 맵에 쓰고 관측에도 반영 (빈 셀 인덱스 슬롯 순서 유지)
+    GameMap& map = simulations[env]->getMap();
+    uint8_t* observation = observations.data() + static_cast<size_t>(env) * cellCount;
+    const int* cells = &stepCells[static_cast<size_t>(env) * MAX_STEP_CELLS];
+    for (int i = 0; i < stepCellCounts[env]; i++) {
+        int cell = cells[i];
+        uint8_t value = resolveCell(env, cell);
+        map.setCellUnchecked(cell % width, cell / width, value);
+        observation[cell] = value;
+    }
+    // 아이템 매니저가 남긴 변경 표시 정리 (updateMap 직후와 같은 상태)
+    map.clearDirty();
+}
+
+uint8_t VecSnakeEnv::resolveCell(int env, int cell) const {
+    // 배열 경로에서 바뀌는 셀은 뱀이 지나간 칸뿐 (Simulation::resolveCell과 같은 우선순위)
+    if (cell == bodyCells[bodyIndex(env, 0)]) {
+        return 3;
+    }
+    if (occupancy[static_cast<size_t>(env) * cellCount + cell] > 0) {
+        return 4;
+    }
+    // 뱀이 비운 칸 아래에도 다른 레이어가 있을 수 있음
+    // (스테이지 전환으로 옮겨진 뱀이 아이템을 덮거나, PLACE_WALL이 맵 반영 전에 머리 앞 칸에 벽을 둠)
+    const Simulation& simulation = *simulations[env];
+    Position pos(cell % width, cell / width);
+    if (simulation.getTemporaryWallManager().hasTemporaryWallAt(pos)) {
+        return 9;
+    }
+    if (simulation.getGateManager().hasGateAt(pos.x, pos.y)) {
+        return GATE_VALUE;
+    }
+    const int* items = &itemCells[static_cast<size_t>(env) * ItemManager::MAX_ITEMS];
+    for (int slot = 0; slot < ItemManager::MAX_ITEMS; slot++) {
+        if (items[slot] == cell) {
+            return itemValues[static_cast<size_t>(env) * ItemManager::MAX_ITEMS + slot];
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+#include "WorkStealingPool.hpp"
+#include <algorithm>
+
+WorkStealingPool::WorkStealingPool(int threadCount)
+    : currentTask(nullptr), jobGeneration(0), idleWorkers(0), stopping(false), stealCount(0) {
+    if (threadCount <= 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (int i = 0; i < threadCount; i++) {
+        ranges.push_back(std::make_unique<Range>());
+    }
+    for (int i = 0; i < threadCount; i++) {
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        stopping = true;
+    }
+    jobStarted.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::parallelFor(size_t count, const Task& task) {
+    if (count == 0) {
+        return;
+    }
+
+    // 인덱스를 워커 수만큼 연속 구간으로 나눠 배분
+    size_t threadCount = workers.size();
+    for (size_t i = 0; i < threadCount; i++) {
+        std::lock_guard<std::mutex> lock(ranges[i]->mutex);
+        ranges[i]->begin = count * i / threadCount;
+        ranges[i]->end = count * (i + 1) / threadCount;
+    }
+
+    std::unique_lock<std::mutex> lock(jobMutex);
+    currentTask = &task;
+    firstError = nullptr;
+    idleWorkers = 0;
+    jobGeneration++;
+    jobStarted.notify_all();
+
+    // 모든 워커가 할 일을 찾지 못하고 쉬게 되면 완료
+    jobFinished.wait(lock, [this]() { return idleWorkers == static_cast<int>(workers.size()); });
+    currentTask = nullptr;
+
+    if (firstError) {
+        std::exception_ptr error = firstError;
+        firstError = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void WorkStealingPool::workerLoop(int worker) {
+    unsigned long long seenGeneration = 0;
+
+    while (true) {
+        const Task* task;
+        {
+            std::unique_lock<std::mutex> lock(jobMutex);
+            jobStarted.wait(lock, [&]() { return stopping || jobGeneration != seenGeneration; });
+            if (stopping) {
+                return;
+            }
+            seenGeneration = jobGeneration;
+            task = currentTask;
+        }
+
+        // 자기 구간을 먼저 처리하고, 비면 다른 워커 구간을 훔침
+        size_t index;
+        while (takeOwn(worker, index) || (steal(worker) && takeOwn(worker, index))) {
+            try {
+                (*task)(index, worker);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(jobMutex);
+                if (!firstError) {
+                    firstError = std::current_exception();
+                }
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(jobMutex);
+            idleWorkers++;
+            if (idleWorkers == static_cast<int>(workers.size())) {
+                jobFinished.notify_one();
+            }
+        }
+    }
+}
+
+bool WorkStealingPool::takeOwn(int worker, size_t& index) {
+    Range& range = *ranges[worker];
+    std::lock_guard<std::mutex> lock(range.mutex);
+    if (range.begin >= range.end) {
+        return false;
+    }
+    index = range.begin++;
+    return true;
+}
+
+bool WorkStealingPool::steal(int worker) {
+    int threadCount = static_cast<int>(ranges.size());
+
+    // 다음 워커부터 차례로 살펴 남은 작업이 있는 구간의 뒤쪽 절반을 가져옴
+    for (int offset = 1; offset < threadCount; offset++) {
+        Range& victim = *ranges[(worker + offset) % threadCount];
+        size_t stolenBegin;
+        size_t stolenEnd;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.begin >= victim.end) {
+                continue;
+            }
+            size_t remaining = victim.end - victim.begin;
+            stolenEnd = victim.end;
+            stolenBegin = victim.end - (remaining + 1) / 2;
+            victim.end = stolenBegin;
+        }
+
+        Range& own = *ranges[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        own.begin = stolenBegin;
+        own.end = stolenEnd;
+        stealCount++;
+        return true;
+    }
+    return false;
+}
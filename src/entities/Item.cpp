@@ -2,9 +2,9 @@
 #include "Snake.hpp"  // Position 구조체를 위해 필요
 
 // 생성자
-Item::Item(int x, int y, ItemType type, std::chrono::milliseconds duration)
-    : x(x), y(y), type(type), duration(duration) {
-    creationTime = std::chrono::steady_clock::now();
+Item::Item(int x, int y, ItemType type, std::chrono::milliseconds duration,
+           GameClock::time_point creationTime)
+    : x(x), y(y), type(type), creationTime(creationTime), duration(duration) {
 }
 
 // 위치 관련 메서드
@@ -26,15 +26,16 @@ ItemType Item::getType() const {
 }
 
 // 만료 관련 메서드
-bool Item::isExpired() const {
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - creationTime);
-    return elapsed >= duration;
+GameClock::time_point Item::getCreationTime() const {
+    return creationTime;
 }
 
-std::chrono::milliseconds Item::getRemainingTime() const {
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - creationTime);
+bool Item::isExpired(GameClock::time_point now) const {
+    return now - creationTime >= duration;
+}
+
+std::chrono::milliseconds Item::getRemainingTime(GameClock::time_point now) const {
+    auto elapsed = now - creationTime;
     auto remaining = duration - elapsed;
     return remaining.count() > 0 ? remaining : std::chrono::milliseconds(0);
 } 
\ No newline at end of file
@@ -1,14 +1,21 @@
 #include "Snake.hpp"
+#include <algorithm>
+#include <utility>
+
+Snake::Snake(int startX, int startY)
+    : direction(Direction::RIGHT), shouldGrow(false),
+      occupancyOriginX(0), occupancyOriginY(0), occupancyWidth(0), occupancyHeight(0) {
+    // 시작 위치가 맵 중앙이라고 보고 맵 전체 크기만큼 점유 그리드 확보
+    occupancyWidth = std::max(2 * startX + 1, 1);
+    occupancyHeight = std::max(2 * startY + 1, 1);
+    occupancy.assign(static_cast<size_t>(occupancyWidth) * occupancyHeight, 0);
 
-Snake::Snake(int startX, int startY) : direction(Direction::RIGHT), shouldGrow(false) {
     // 초기 길이 3으로 설정
-    body.push_back(Position(startX, startY));       // 머리
-    body.push_back(Position(startX - 1, startY));   // 몸통
-    body.push_back(Position(startX - 2, startY));   // 꼬리
+    reset(startX, startY);
 }
 
 Snake::~Snake() {
-    // vector는 자동으로 메모리 해제
+    // SnakeBody는 자동으로 메모리 해제
 }
 
 void Snake::move() {
@@ -30,12 +37,18 @@ void Snake::move() {
             break;
     }
     
-    // 새로운 머리를 앞에 추가
-    body.insert(body.begin(), newHead);
+    // 이전 머리 셀은 몸통으로 바뀜
+    changedCells.push_back(body[0]);
+
+    // 새로운 머리를 앞에 추가 (링 버퍼이므로 O(1))
+    addOccupancy(newHead);
+    body.push_front(newHead);
     
     // 성장하지 않는 경우 꼬리 제거
     if (!shouldGrow) {
+        Position tail = body.back();
         body.pop_back();
+        removeOccupancy(tail);
     } else {
         shouldGrow = false;
     }
@@ -52,20 +65,17 @@ void Snake::grow() {
     shouldGrow = true;
     // 즉시 길이를 늘리기 위해 꼬리 복사
     if (!body.empty()) {
-        body.push_back(body.back());
+        Position tail = body.back();
+        addOccupancy(tail);
+        body.push_back(tail);
     }
 }
 
 bool Snake::checkSelfCollision() const {
     const Position& head = body[0];
     
-    // 머리가 몸통과 충돌하는지 확인 (머리 제외)
-    for (size_t i = 1; i < body.size(); i++) {
-        if (head == body[i]) {
-            return true;
-        }
-    }
-    return false;
+    // 머리 셀에 머리 외의 마디가 겹쳐 있으면 충돌
+    return getOccupancy(head.x, head.y) > 1;
 }
 
 bool Snake::isOppositeDirection(Direction newDir) const {
@@ -94,7 +104,9 @@ bool Snake::applyPoisonItem() {
     
     // 꼬리 제거 (길이 감소)
     if (!body.empty()) {
+        Position tail = body.back();
         body.pop_back();
+        removeOccupancy(tail);
     }
     
     return true;  // 성공적으로 길이 감소
@@ -102,20 +114,167 @@ bool Snake::applyPoisonItem() {
 
 void Snake::teleportTo(const Position& newPosition) {
     if (!body.empty()) {
+        removeOccupancy(body[0]);
+        addOccupancy(newPosition);
         body[0] = newPosition;  // 머리 위치를 새 위치로 이동
     }
 }
 
 void Snake::reset(int startX, int startY) {
     // 몸통 초기화
+    for (const auto& segment : body) {
+        removeOccupancy(segment);
+    }
     body.clear();
     
     // 초기 길이 3으로 설정
-    body.push_back(Position(startX, startY));       // 머리
-    body.push_back(Position(startX - 1, startY));   // 몸통
-    body.push_back(Position(startX - 2, startY));   // 꼬리
+    const Position initialBody[] = {
+        Position(startX, startY),       // 머리
+        Position(startX - 1, startY),   // 몸통
+        Position(startX - 2, startY)    // 꼬리
+    };
+    for (const auto& segment : initialBody) {
+        addOccupancy(segment);
+        body.push_back(segment);
+    }
     
     // 초기 방향과 상태 설정
     direction = Direction::RIGHT;
     shouldGrow = false;
-} 
\ No newline at end of file
+} 
+
+void Snake::assignBody(const Position* segments, size_t length, Direction newDirection, bool growing) {
+    for (const auto& segment : body) {
+        removeOccupancy(segment);
+    }
+    body.clear();
+    for (size_t i = 0; i < length; i++) {
+        addOccupancy(segments[i]);
+        body.push_back(segments[i]);
+    }
+    direction = newDirection;
+    shouldGrow = growing;
+    changedCells.clear();
+}
+
+void Snake::saveState(StateWriter& out) const {
+    out.writeByte(static_cast<uint8_t>(direction));
+    out.writeBool(shouldGrow);
+    out.writeVarint(body.size());
+    for (const auto& segment : body) {
+        out.writeInt(segment.x);
+        out.writeInt(segment.y);
+    }
+    out.writeVarint(changedCells.size());
+    for (const auto& pos : changedCells) {
+        out.writeInt(pos.x);
+        out.writeInt(pos.y);
+    }
+}
+
+bool Snake::loadState(StateReader& in, int mapWidth, int mapHeight) {
+    uint8_t savedDirection = in.readByte();
+    bool savedShouldGrow = in.readBool();
+    if (savedDirection > static_cast<uint8_t>(Direction::RIGHT)) {
+        in.fail();
+    }
+    // 좌표 하나는 최소 2바이트
+    size_t length = in.readCount(in.remaining() / 2);
+    if (!in.ok() || length == 0) {
+        in.fail();
+        return false;
+    }
+
+    // 좌표를 모두 확인한 뒤에 몸통 교체 (맵 밖 좌표로 점유 카운터를 키우지 않도록)
+    auto readPosition = [&in, mapWidth, mapHeight](Position& pos) {
+        pos.x = in.readInt32();
+        pos.y = in.readInt32();
+        if (pos.x < 0 || pos.x >= mapWidth || pos.y < 0 || pos.y >= mapHeight) {
+            in.fail();
+        }
+        return in.ok();
+    };
+    std::vector<Position> segments(length);
+    for (size_t i = 0; i < length; i++) {
+        if (!readPosition(segments[i])) {
+            return false;
+        }
+    }
+    std::vector<Position> savedChangedCells(in.readCount(in.remaining() / 2));
+    for (auto& pos : savedChangedCells) {
+        if (!readPosition(pos)) {
+            return false;
+        }
+    }
+
+    for (const auto& segment : body) {
+        removeOccupancy(segment);
+    }
+    body.clear();
+    for (const auto& segment : segments) {
+        addOccupancy(segment);
+        body.push_back(segment);
+    }
+    direction = static_cast<Direction>(savedDirection);
+    shouldGrow = savedShouldGrow;
+
+    // 점유 갱신으로 쌓인 기록 대신 저장 시점의 변경 목록 사용
+    changedCells = std::move(savedChangedCells);
+    return in.ok();
+}
+
+void Snake::addOccupancy(const Position& pos) {
+    int gx = pos.x - occupancyOriginX;
+    int gy = pos.y - occupancyOriginY;
+    if (gx < 0 || gx >= occupancyWidth || gy < 0 || gy >= occupancyHeight) {
+        expandOccupancyToCover(pos);
+        gx = pos.x - occupancyOriginX;
+        gy = pos.y - occupancyOriginY;
+    }
+    occupancy.write(gy * occupancyWidth + gx)++;
+    changedCells.push_back(pos);
+}
+
+void Snake::removeOccupancy(const Position& pos) {
+    int gx = pos.x - occupancyOriginX;
+    int gy = pos.y - occupancyOriginY;
+    if (gx < 0 || gx >= occupancyWidth || gy < 0 || gy >= occupancyHeight) return;
+    size_t index = static_cast<size_t>(gy) * occupancyWidth + gx;
+    if (occupancy[index] > 0) {
+        occupancy.write(index)--;
+    }
+    changedCells.push_back(pos);
+}
+
+void Snake::expandOccupancyToCover(const Position& pos) {
+    // 새 범위: 기존 범위와 pos를 포함하고, 확장한 방향으로 기존 크기만큼 여유를 둠
+    int minX = occupancyOriginX;
+    int minY = occupancyOriginY;
+    int maxX = occupancyOriginX + occupancyWidth - 1;
+    int maxY = occupancyOriginY + occupancyHeight - 1;
+    int padX = std::max(occupancyWidth, 8);
+    int padY = std::max(occupancyHeight, 8);
+
+    if (pos.x < minX) minX = pos.x - padX;
+    if (pos.x > maxX) maxX = pos.x + padX;
+    if (pos.y < minY) minY = pos.y - padY;
+    if (pos.y > maxY) maxY = pos.y + padY;
+
+    // 기존 카운터를 새 그리드로 복사
+    int newWidth = maxX - minX + 1;
+    int newHeight = maxY - minY + 1;
+    CowArray<uint16_t> newOccupancy(static_cast<size_t>(newWidth) * newHeight, 0);
+    for (int y = 0; y < occupancyHeight; y++) {
+        for (int x = 0; x < occupancyWidth; x++) {
+            int nx = x + occupancyOriginX - minX;
+            int ny = y + occupancyOriginY - minY;
+            newOccupancy.set(ny * newWidth + nx, occupancy[y * occupancyWidth + x]);
+        }
+    }
+
+    occupancy = std::move(newOccupancy);
+    occupancyOriginX = minX;
+    occupancyOriginY = minY;
+    occupancyWidth = newWidth;
+    occupancyHeight = newHeight;
+}
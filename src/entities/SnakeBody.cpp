@@ -0,0 +1,49 @@
+#include "SnakeBody.hpp"
+
+SnakeBody::SnakeBody(size_t initialCapacity) : headIndex(0), count(0) {
+    // 인덱스 계산을 비트 마스크로 하기 위해 2의 거듭제곱으로 올림
+    size_t capacity = 1;
+    while (capacity < initialCapacity) {
+        capacity <<= 1;
+    }
+    buffer.resize(capacity);
+    mask = capacity - 1;
+}
+
+void SnakeBody::push_front(const Position& position) {
+    if (count == buffer.size()) {
+        expand();
+    }
+    headIndex = (headIndex - 1) & mask;
+    buffer[headIndex] = position;
+    count++;
+}
+
+void SnakeBody::push_back(const Position& position) {
+    if (count == buffer.size()) {
+        expand();
+    }
+    buffer[(headIndex + count) & mask] = position;
+    count++;
+}
+
+void SnakeBody::pop_back() {
+    if (count > 0) {
+        count--;
+    }
+}
+
+void SnakeBody::clear() {
+    headIndex = 0;
+    count = 0;
+}
+
+void SnakeBody::expand() {
+    std::vector<Position> newBuffer(buffer.size() * 2);
+    for (size_t i = 0; i < count; i++) {
+        newBuffer[i] = (*this)[i];
+    }
+    buffer.swap(newBuffer);
+    headIndex = 0;
+    mask = buffer.size() - 1;
+}
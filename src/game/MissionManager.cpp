@@ -3,6 +3,21 @@
 MissionManager::MissionManager() {
 }
 
+MissionManager::MissionManager(const MissionManager& other) {
+    *this = other;
+}
+
+MissionManager& MissionManager::operator=(const MissionManager& other) {
+    if (this != &other) {
+        missions.clear();
+        missions.reserve(other.missions.size());
+        for (const auto& mission : other.missions) {
+            missions.push_back(std::make_unique<Mission>(*mission));
+        }
+    }
+    return *this;
+}
+
 void MissionManager::addMission(MissionType type, int targetValue, const std::string& description) {
     missions.push_back(std::make_unique<Mission>(type, targetValue, description));
 }
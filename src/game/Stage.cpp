@@ -2,7 +2,7 @@
 #include "GameMap.hpp"
 
 Stage::Stage(int number, const std::string& name)
-    : stageNumber(number), stageName(name) {
+    : stageNumber(number), stageName(name), wallLayout(std::make_shared<std::vector<std::pair<int, int>>>()) {
 }
 
 int Stage::getStageNumber() const {
@@ -14,7 +14,7 @@ std::string Stage::getStageName() const {
 }
 
 void Stage::setWallLayout(const std::vector<std::pair<int, int>>& walls) {
-    wallLayout = walls;
+    wallLayout = std::make_shared<std::vector<std::pair<int, int>>>(walls);
 }
 
 void Stage::applyToMap(GameMap& map) const {
@@ -26,7 +26,7 @@ void Stage::applyToMap(GameMap& map) const {
     }
     
     // 벽 레이아웃 적용
-    for (const auto& wall : wallLayout) {
+    for (const auto& wall : *wallLayout) {
         int x = wall.first;
         int y = wall.second;
         if (x >= 1 && x < 20 && y >= 1 && y < 20) {
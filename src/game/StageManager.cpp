@@ -7,13 +7,13 @@ StageManager::StageManager() : currentStageIndex(0) {
 
 void StageManager::initializeStages() {
     // Stage 1: Basic Stage (빈 맵)
-    auto stage1 = std::make_unique<Stage>(1, "Basic Stage");
+    auto stage1 = std::make_shared<Stage>(1, "Basic Stage");
     stage1->addMission(MissionType::GROWTH_ITEMS, 1, "Collect 1 growth item");
     // 벽 레이아웃 없음 (빈 맵)
     stages.push_back(std::move(stage1));
 
     // Stage 2: Cross Stage (간단한 십자가 맵)
-    auto stage2 = std::make_unique<Stage>(2, "Cross Stage");
+    auto stage2 = std::make_shared<Stage>(2, "Cross Stage");
     stage2->addMission(MissionType::GROWTH_ITEMS, 1, "Collect 1 growth item");
     stage2->addMission(MissionType::GATES, 1, "Use gates 1 time");
     
@@ -30,7 +30,7 @@ void StageManager::initializeStages() {
     stages.push_back(std::move(stage2));
 
     // Stage 3: L-Shape Stage (간단한 L자 모양)
-    auto stage3 = std::make_unique<Stage>(3, "L-Shape Stage");
+    auto stage3 = std::make_shared<Stage>(3, "L-Shape Stage");
     stage3->addMission(MissionType::GROWTH_ITEMS, 1, "Collect 1 growth item");
     stage3->addMission(MissionType::GATES, 1, "Use gates 1 time");
     
@@ -45,7 +45,7 @@ void StageManager::initializeStages() {
     stages.push_back(std::move(stage3));
 
     // Stage 4: Box Stage (간단한 사각형 구조)
-    auto stage4 = std::make_unique<Stage>(4, "Box Stage");
+    auto stage4 = std::make_shared<Stage>(4, "Box Stage");
     stage4->addMission(MissionType::GROWTH_ITEMS, 1, "Collect 1 growth item");
     stage4->addMission(MissionType::GATES, 1, "Use gates 1 time");
     
@@ -96,14 +96,14 @@ bool StageManager::nextStage() {
 
 void StageManager::resetGame() {
     currentStageIndex = 0;
-    for (auto& stage : stages) {
-        stage->resetMissions();
+    for (int i = 0; i < static_cast<int>(stages.size()); i++) {
+        mutableStage(i).resetMissions();
     }
 }
 
 void StageManager::resetCurrentStage() {
     if (currentStageIndex >= 0 && currentStageIndex < static_cast<int>(stages.size())) {
-        stages[currentStageIndex]->resetMissions();
+        mutableStage(currentStageIndex).resetMissions();
     }
 }
 
@@ -115,12 +115,19 @@ void StageManager::applyCurrentStageToMap(GameMap& map) const {
 }
 
 void StageManager::updateMissionProgress(MissionType type, int currentValue) {
-    Stage* currentStage = stages[currentStageIndex].get();
-    if (currentStage) {
-        currentStage->updateMissionProgress(type, currentValue);
+    if (currentStageIndex >= 0 && currentStageIndex < static_cast<int>(stages.size())) {
+        mutableStage(currentStageIndex).updateMissionProgress(type, currentValue);
     }
 }
 
+Stage& StageManager::mutableStage(int index) {
+    std::shared_ptr<Stage>& stage = stages[index];
+    if (stage.use_count() != 1) {
+        stage = std::make_shared<Stage>(*stage);
+    }
+    return *stage;
+}
+
 bool StageManager::isCurrentStageCompleted() const {
     const Stage* currentStage = getCurrentStage();
     return currentStage ? currentStage->allMissionsCompleted() : false;
@@ -128,4 +135,41 @@ bool StageManager::isCurrentStageCompleted() const {
 
 bool StageManager::isGameCompleted() const {
     return isLastStage() && isCurrentStageCompleted();
-} 
\ No newline at end of file
+}
+
+void StageManager::saveState(StateWriter& out) const {
+    out.writeVarint(static_cast<uint64_t>(currentStageIndex));
+    out.writeVarint(stages.size());
+    for (const auto& stage : stages) {
+        out.writeVarint(static_cast<uint64_t>(stage->getMissionCount()));
+        for (int i = 0; i < stage->getMissionCount(); i++) {
+            out.writeInt(stage->getMission(i)->getCurrentValue());
+        }
+    }
+}
+
+bool StageManager::loadState(StateReader& in) {
+    size_t stageIndex = in.readVarint();
+    // 스테이지 구성은 코드에 고정되어 있으므로 개수가 다르면 다른 버전의 스냅샷
+    if (stageIndex >= stages.size() || in.readVarint() != stages.size()) {
+        in.fail();
+        return false;
+    }
+    currentStageIndex = static_cast<int>(stageIndex);
+
+    for (int index = 0; index < static_cast<int>(stages.size()); index++) {
+        if (in.readVarint() != static_cast<uint64_t>(stages[index]->getMissionCount())) {
+            in.fail();
+            return false;
+        }
+        // 스테이지 안에서 미션 종류는 겹치지 않으므로 종류별 진행도 갱신으로 복원 (값이 같으면 복제 안 함)
+        for (int i = 0; i < stages[index]->getMissionCount(); i++) {
+            const Mission* mission = stages[index]->getMission(i);
+            int value = in.readInt32();
+            if (mission->getCurrentValue() != value) {
+                mutableStage(index).updateMissionProgress(mission->getType(), value);
+            }
+        }
+    }
+    return in.ok();
+}
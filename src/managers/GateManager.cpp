@@ -1,16 +1,54 @@
 #include "GateManager.hpp"
 #include <algorithm>
+#include <utility>
 #include <chrono>
 #include <set>
 
-GateManager::GateManager(GameMap& map) 
-    : map(map), rng(std::random_device{}()), dist(0, 100), nextPairId(1) {
+namespace {
+
+Position stepPosition(const Position& from, Direction direction) {
+    switch (direction) {
+        case Direction::UP:    return Position(from.x, from.y - 1);
+        case Direction::DOWN:  return Position(from.x, from.y + 1);
+        case Direction::LEFT:  return Position(from.x - 1, from.y);
+        case Direction::RIGHT: return Position(from.x + 1, from.y);
+    }
+    return from;
+}
+
+}  // namespace
+
+GateManager::GateManager(GameMap& map, const GameClock& clock, const GameRng& stream)
+    : map(map), clock(clock), rng(stream), nextPairId(1) {
+}
+
+GateManager::GateManager(const GateManager& other, GameMap& map, const GameClock& clock)
+    : map(map), clock(clock), gates(other.gates), expiryScheduler(other.expiryScheduler),
+      rng(other.rng), nextPairId(other.nextPairId), teleportEdges(other.teleportEdges),
+      snakeEnteringStates(other.snakeEnteringStates) {
 }
 
 GateManager::~GateManager() {
     // vector는 자동으로 메모리 해제
 }
 
+void GateManager::clear() {
+    gates.clear();
+    expiryScheduler.clear();
+    nextPairId = 1;
+    teleportEdges.clear();
+    snakeEnteringStates.clear();
+}
+
+void GateManager::swapState(GateManager& other) {
+    std::swap(gates, other.gates);
+    std::swap(expiryScheduler, other.expiryScheduler);
+    std::swap(rng, other.rng);
+    std::swap(nextPairId, other.nextPairId);
+    std::swap(teleportEdges, other.teleportEdges);
+    std::swap(snakeEnteringStates, other.snakeEnteringStates);
+}
+
 void GateManager::generateGates(const Snake& snake) {
     // 이미 게이트가 존재하면 생성하지 않음
     if (gates.size() >= MAX_GATES * 2) {
@@ -29,16 +67,12 @@ void GateManager::generateGates(const Snake& snake) {
         restoreGatePositionsToWalls();
     }
     
-    // 벽 위치 찾기
-    std::vector<Position> wallPositions = findWallPositions(snake);
-    
-    if (wallPositions.size() < 2) {
-        return;  // 게이트를 생성할 수 있는 벽이 충분하지 않음
+    // 맵이 유지하는 벽 셀 인덱스에서 랜덤하게 입구 위치 선택
+    auto entrance = drawWallPosition(std::nullopt, Position(-1, -1), snake);
+    if (!entrance.has_value()) {
+        return;  // 게이트를 생성할 수 있는 벽이 없음
     }
-    
-    // 랜덤하게 입구 위치 선택
-    std::uniform_int_distribution<int> wallDist(0, wallPositions.size() - 1);
-    Position entrancePos = wallPositions[wallDist(rng)];
+    Position entrancePos = entrance.value();
     
     // 입구 게이트의 벽 타입 결정
     WallType entranceWallType = determineWallType(entrancePos.x, entrancePos.y);
@@ -61,41 +95,62 @@ void GateManager::generateGates(const Snake& snake) {
     
     // 게이트 쌍 생성
     int pairId = nextPairId++;
-    gates.emplace_back(entrancePos.x, entrancePos.y, GateType::ENTRANCE, entranceWallType, pairId, entranceOriginalValue);
-    gates.emplace_back(exitPos.x, exitPos.y, GateType::EXIT, exitWallType, pairId, exitOriginalValue);
+    auto now = clock.now();
+    gates.emplace_back(entrancePos.x, entrancePos.y, GateType::ENTRANCE, entranceWallType, pairId, entranceOriginalValue, now);
+    gates.emplace_back(exitPos.x, exitPos.y, GateType::EXIT, exitWallType, pairId, exitOriginalValue, now);
+    expiryScheduler.schedule(entrancePos.y * map.getStride() + entrancePos.x, gates[gates.size() - 2].getExpiryTime());
+    expiryScheduler.schedule(exitPos.y * map.getStride() + exitPos.x, gates.back().getExpiryTime());
     
     // 맵에 게이트 설정
     map.setGate(entrancePos.x, entrancePos.y);
     map.setGate(exitPos.x, exitPos.y);
+    map.markDirty(entrancePos.x, entrancePos.y);
+    map.markDirty(exitPos.x, exitPos.y);
+    addTeleportEdges(pairId);
 }
 
 void GateManager::removeExpiredGates() {
-    auto currentTime = std::chrono::steady_clock::now();
+    // 이번 틱에 만료 예정인 Gate만 확인
+    auto currentTime = clock.now();
+    if (!expiryScheduler.hasDue(currentTime)) {
+        return;
+    }
     
-    // 만료된 게이트들의 위치를 벽으로 복원
-    for (auto it = gates.begin(); it != gates.end();) {
-        Position gatePos = it->getPosition();
+    dueKeys.clear();
+    expiryScheduler.popDue(currentTime, dueKeys);
+    int stride = map.getStride();
+    for (int key : dueKeys) {
+        Position gatePos(key % stride, key / stride);
+        auto it = std::find_if(gates.begin(), gates.end(), [&](const Gate& gate) {
+            return gate.getPosition() == gatePos && gate.isExpired(currentTime);
+        });
+        if (it == gates.end()) {
+            continue;  // 이미 복원된 Gate
+        }
         
-        // Snake가 진입 중인 Gate는 만료되지 않음
-        if (it->isExpired() && !isSnakeEntering(gatePos)) {
-            // 게이트 위치를 원래 벽 값으로 복원
-            int x = it->getX();
-            int y = it->getY();
-            int originalValue = it->getOriginalWallValue();
-            
-            if (originalValue == 1) {
-                map.setWall(x, y);
-            } else if (originalValue == 2) {
-                map.setCellValue(x, y, 2);  // Immune Wall
-            }
-            
-            // 진입 상태 정보도 제거
-            snakeEnteringStates.erase(gatePos);
-            
-            it = gates.erase(it);
-        } else {
-            ++it;
+        // Snake가 진입 중인 Gate는 만료되지 않음 (다음 틱에 다시 확인)
+        if (isSnakeEntering(gatePos)) {
+            expiryScheduler.schedule(key, currentTime);
+            continue;
         }
+        
+        // 게이트 위치를 원래 벽 값으로 복원
+        int x = it->getX();
+        int y = it->getY();
+        int originalValue = it->getOriginalWallValue();
+        
+        if (originalValue == 1) {
+            map.setWall(x, y);
+        } else if (originalValue == 2) {
+            map.setCellValue(x, y, 2);  // Immune Wall
+        }
+        map.markDirty(x, y);
+        
+        // 진입 상태 정보도 제거
+        snakeEnteringStates.erase(gatePos);
+        
+        removeTeleportEdges(it->getPairId());
+        gates.erase(it);
     }
 }
 
@@ -111,10 +166,13 @@ void GateManager::restoreGatePositionsToWalls() {
         } else if (originalValue == 2) {
             map.setCellValue(x, y, 2);  // Immune Wall
         }
+        map.markDirty(x, y);
     }
     
     // 모든 게이트 제거
     gates.clear();
+    teleportEdges.clear();
+    expiryScheduler.clear();
 }
 
 void GateManager::updateMap() {
@@ -123,6 +181,15 @@ void GateManager::updateMap() {
     }
 }
 
+bool GateManager::hasGateAt(int x, int y) const {
+    for (const auto& gate : gates) {
+        if (gate.getX() == x && gate.getY() == y) {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::optional<Gate> GateManager::checkCollision(const Snake& snake) {
     Position headPos = snake.getHead();
     
@@ -159,15 +226,7 @@ Position GateManager::calculateExitPosition(const Gate& entrance, Direction snak
                     map.getCellValue(newPos.x, newPos.y) == 0) {
                     
                     // Snake와 겹치지 않는지 확인
-                    bool collision = false;
-                    for (const auto& bodyPart : snake.getBody()) {
-                        if (bodyPart == newPos) {
-                            collision = true;
-                            break;
-                        }
-                    }
-                    
-                    if (!collision) {
+                    if (!snake.isOccupied(newPos)) {
                         return newPos;
                     }
                 }
@@ -208,15 +267,7 @@ Position GateManager::calculateBidirectionalExitPosition(const Gate& currentGate
                     map.getCellValue(newPos.x, newPos.y) == 0) {
                     
                     // Snake와 겹치지 않는지 확인
-                    bool collision = false;
-                    for (const auto& bodyPart : snake.getBody()) {
-                        if (bodyPart == newPos) {
-                            collision = true;
-                            break;
-                        }
-                    }
-                    
-                    if (!collision) {
+                    if (!snake.isOccupied(newPos)) {
                         return newPos;
                     }
                 }
@@ -231,19 +282,99 @@ Position GateManager::calculateBidirectionalExitPosition(const Gate& currentGate
     return Position(-1, -1);
 }
 
-std::vector<Position> GateManager::findWallPositions(const Snake& snake) {
-    std::vector<Position> wallPositions;
+void GateManager::addTeleportEdges(int pairId) {
+    for (const auto& gate : gates) {
+        if (gate.getPairId() != pairId) continue;
+        auto partner = std::find_if(gates.begin(), gates.end(), [&](const Gate& other) {
+            return other.getPairId() == pairId && other.getPosition() != gate.getPosition();
+        });
+        if (partner == gates.end()) continue;
+
+        const Direction entries[] = {Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT};
+        for (Direction entry : entries) {
+            // entry 방향으로 들어오려면 반대쪽 이웃 칸에 머리가 있어야 함
+            Position from = stepPosition(gate.getPosition(), getOppositeDirection(entry));
+            if (!map.isValidPosition(from.x, from.y)) continue;
+
+            // handleGateCollision과 같은 순서: 들어간 Gate 기준 진출 방향 → 상대 Gate 주변 우선순위
+            Direction exitDirection = gate.isOuterWall()
+                ? calculateOuterWallExitDirection(gate.getPosition(), entry)
+                : calculateInnerWallDirectionPriority(gate.getPosition(), entry)[0];
+            TeleportEdge edge;
+            edge.from = from;
+            edge.gate = gate.getPosition();
+            edge.entryDirection = entry;
+            edge.pairId = pairId;
+            edge.exitCount = 0;
+            for (Direction direction : getDirectionPriority(partner->getPosition(), exitDirection)) {
+                edge.exits[edge.exitCount++] = stepPosition(partner->getPosition(), direction);
+            }
+            teleportEdges.push_back(edge);
+        }
+    }
+}
+
+void GateManager::removeTeleportEdges(int pairId) {
+    teleportEdges.erase(std::remove_if(teleportEdges.begin(), teleportEdges.end(),
+                                       [pairId](const TeleportEdge& edge) { return edge.pairId == pairId; }),
+                        teleportEdges.end());
+}
+
+std::optional<Position> GateManager::resolveTeleportExit(const TeleportEdge& edge) const {
+    for (int i = 0; i < edge.exitCount; i++) {
+        const Position& exit = edge.exits[i];
+        if (map.isValidPosition(exit.x, exit.y) && map.getCellValue(exit.x, exit.y) == 0) {
+            return exit;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Position> GateManager::drawWallPosition(std::optional<WallSide> excludedSide,
+                                                      const Position& excludedPos, const Snake& snake) {
+    // 제외할 외곽 벽을 뺀 나머지 위치별 후보 수를 가중치로 사용
+    std::array<int, GameMap::WALL_SIDE_COUNT> counts{};
+    int total = 0;
+    for (int side = 0; side < GameMap::WALL_SIDE_COUNT; side++) {
+        if (excludedSide.has_value() && static_cast<int>(excludedSide.value()) == side) {
+            continue;
+        }
+        counts[side] = static_cast<int>(map.getWallCells(static_cast<WallSide>(side)).size());
+        total += counts[side];
+    }
+    
+    if (total == 0) {
+        return std::nullopt;
+    }
+    
+    // 후보 전체에서 균등 추출 (뱀/기존 Gate와 겹치면 몇 번 재시도)
+    for (int attempts = 0; attempts < 8; attempts++) {
+        int pick = rng.uniformInt(total);
+        int side = 0;
+        while (pick >= counts[side]) {
+            pick -= counts[side];
+            side++;
+        }
+        
+        auto [x, y] = map.cellPosition(map.getWallCells(static_cast<WallSide>(side))[pick]);
+        if (Position(x, y) != excludedPos && isValidGatePosition(x, y, snake)) {
+            return Position(x, y);
+        }
+    }
     
-    for (int y = 0; y < map.getHeight(); y++) {
-        for (int x = 0; x < map.getWidth(); x++) {
-            int cellValue = map.getCellValue(x, y);
-            if ((cellValue == 1 || cellValue == 2) && isValidGatePosition(x, y, snake)) {
-                wallPositions.push_back(Position(x, y));
+    // 재시도가 모두 실패하면 후보를 한 번 순회
+    for (int side = 0; side < GameMap::WALL_SIDE_COUNT; side++) {
+        if (counts[side] == 0) continue;
+        const CellIndex& walls = map.getWallCells(static_cast<WallSide>(side));
+        for (size_t slot = 0; slot < walls.size(); slot++) {
+            auto [x, y] = map.cellPosition(walls[slot]);
+            if (Position(x, y) != excludedPos && isValidGatePosition(x, y, snake)) {
+                return Position(x, y);
             }
         }
     }
     
-    return wallPositions;
+    return std::nullopt;
 }
 
 WallType GateManager::determineWallType(int x, int y) {
@@ -267,10 +398,8 @@ bool GateManager::isValidGatePosition(int x, int y, const Snake& snake) {
     }
     
     // Snake와 겹치지 않는지 확인
-    for (const auto& bodyPart : snake.getBody()) {
-        if (bodyPart.x == x && bodyPart.y == y) {
-            return false;
-        }
+    if (snake.isOccupied(x, y)) {
+        return false;
     }
     
     // 기존 Gate와 겹치지 않는지 확인
@@ -284,35 +413,16 @@ bool GateManager::isValidGatePosition(int x, int y, const Snake& snake) {
 }
 
 Position GateManager::findValidExitPosition(const Position& entrance, Direction preferredDirection, const Snake& snake) {
-    auto wallPositions = findWallPositions(snake);
-    
-    // 입구가 외부벽인지 확인
-    bool entranceIsOuter = (entrance.x == 0 || entrance.x == map.getWidth() - 1 || 
-                           entrance.y == 0 || entrance.y == map.getHeight() - 1);
-    
-    // 입구와 다른 위치 중에서 선택
-    std::vector<Position> validExitPositions;
-    for (const auto& pos : wallPositions) {
-        if (!(pos == entrance)) {
-            // 입구가 외부벽인 경우, 출구는 다른 벽에 위치해야 함
-            if (entranceIsOuter) {
-                if (!isSameOuterWall(entrance, pos)) {
-                    validExitPositions.push_back(pos);
-                }
-            } else {
-                // 내부벽인 경우 기존 로직 유지
-                validExitPositions.push_back(pos);
-            }
-        }
-    }
-    
-    if (validExitPositions.empty()) {
-        return Position(-1, -1);
+    // 입구가 외부벽인 경우, 출구는 다른 벽에 위치해야 함 (같은 외곽 벽 묶음 제외)
+    std::optional<WallSide> excludedSide;
+    WallSide entranceSide = map.getWallSide(entrance.x, entrance.y);
+    if (entranceSide != WallSide::INNER) {
+        excludedSide = entranceSide;
     }
     
-    // 랜덤하게 출구 위치 선택
-    std::uniform_int_distribution<size_t> exitDist(0, validExitPositions.size() - 1);
-    return validExitPositions[exitDist(rng)];
+    // 입구와 다른 위치 중에서 선택
+    auto exitPos = drawWallPosition(excludedSide, entrance, snake);
+    return exitPos.value_or(Position(-1, -1));
 }
 
 std::vector<Direction> GateManager::getDirectionPriority(const Position& gatePos, Direction snakeDirection) {
@@ -472,4 +582,75 @@ bool GateManager::isSameOuterWall(const Position& pos1, const Position& pos2) {
     if (pos1.x == width - 1 && pos2.x == width - 1) return true;
     
     return false;  // 다른 벽에 있음
-} 
\ No newline at end of file
+}
+
+void GateManager::saveState(StateWriter& out) const {
+    out.writeVarint(gates.size());
+    for (const auto& gate : gates) {
+        out.writeInt(gate.getX());
+        out.writeInt(gate.getY());
+        out.writeByte(static_cast<uint8_t>(gate.getType()));
+        out.writeByte(static_cast<uint8_t>(gate.getWallType()));
+        out.writeInt(gate.getPairId());
+        out.writeInt(gate.getOriginalWallValue());
+        out.writeInt(gate.getCreationTime().time_since_epoch().count());
+    }
+    out.writeVarint(snakeEnteringStates.size());
+    for (const auto& [pos, entering] : snakeEnteringStates) {
+        out.writeInt(pos.x);
+        out.writeInt(pos.y);
+        out.writeBool(entering);
+    }
+    out.writeInt(nextPairId);
+    expiryScheduler.saveState(out);
+    rng.saveState(out);
+}
+
+bool GateManager::loadState(StateReader& in) {
+    size_t count = in.readCount(MAX_GATES * 2);
+    gates.clear();
+    for (size_t i = 0; i < count && in.ok(); i++) {
+        int x = in.readInt32();
+        int y = in.readInt32();
+        uint8_t type = in.readByte();
+        uint8_t wallType = in.readByte();
+        int pairId = in.readInt32();
+        int originalWallValue = in.readInt32();
+        GameClock::time_point creationTime(GameClock::duration(in.readInt()));
+        if (type > static_cast<uint8_t>(GateType::EXIT) || wallType > static_cast<uint8_t>(WallType::INNER)) {
+            in.fail();
+            break;
+        }
+        // Gate가 사라질 때 되돌릴 벽 값은 벽(1) 또는 Immune Wall(2)만 가능
+        if (!map.isValidPosition(x, y) || (originalWallValue != 1 && originalWallValue != 2)) {
+            in.fail();
+            break;
+        }
+        gates.emplace_back(x, y, static_cast<GateType>(type), static_cast<WallType>(wallType),
+                           pairId, originalWallValue, creationTime);
+    }
+
+    snakeEnteringStates.clear();
+    size_t enteringCount = in.readCount(in.remaining() / 3);
+    for (size_t i = 0; i < enteringCount && in.ok(); i++) {
+        int x = in.readInt32();
+        int y = in.readInt32();
+        bool entering = in.readBool();
+        if (!hasGateAt(x, y)) {
+            in.fail();
+            break;
+        }
+        snakeEnteringStates[Position(x, y)] = entering;
+    }
+
+    nextPairId = in.readInt32();
+    teleportEdges.clear();
+    for (const auto& gate : gates) {
+        if (gate.isEntrance()) {
+            addTeleportEdges(gate.getPairId());
+        }
+    }
+    expiryScheduler.loadState(in, in.remaining() / 2);
+    rng.loadState(in);
+    return in.ok();
+}
@@ -1,8 +1,16 @@
 #include "ItemManager.hpp"
 #include <algorithm>
+#include <utility>
 
 // 생성자
-ItemManager::ItemManager(GameMap& gameMap) : gameMap(gameMap), gen(rd()) {
+ItemManager::ItemManager(GameMap& gameMap, const GameClock& clock, const GameRng& stream)
+    : gameMap(gameMap), clock(clock), rng(stream) {
+    items.reserve(MAX_ITEMS);
+}
+
+ItemManager::ItemManager(const ItemManager& other, GameMap& gameMap, const GameClock& clock)
+    : gameMap(gameMap), clock(clock), items(other.items), expiryScheduler(other.expiryScheduler),
+      rng(other.rng) {
     items.reserve(MAX_ITEMS);
 }
 
@@ -23,23 +31,43 @@ void ItemManager::generateItems(const Snake& snake) {
     ItemType type = getRandomItemType();
     
     // 아이템 생성
-    items.emplace_back(emptyPos->x, emptyPos->y, type);
+    items.emplace_back(emptyPos->x, emptyPos->y, type, std::chrono::seconds(5), clock.now());
+    expiryScheduler.schedule(emptyPos->y * gameMap.getStride() + emptyPos->x, items.back().getExpiryTime());
+    gameMap.markDirty(emptyPos->x, emptyPos->y);
 }
 
 // 아이템 추가 (테스트용)
 void ItemManager::addItem(int x, int y, ItemType type, std::chrono::milliseconds duration) {
     if (items.size() < MAX_ITEMS) {
-        items.emplace_back(x, y, type, duration);
+        items.emplace_back(x, y, type, duration, clock.now());
+        expiryScheduler.schedule(y * gameMap.getStride() + x, items.back().getExpiryTime());
+        gameMap.markDirty(x, y);
     }
 }
 
 // 만료된 아이템 제거
 void ItemManager::removeExpiredItems() {
-    items.erase(
-        std::remove_if(items.begin(), items.end(),
-                      [](const Item& item) { return item.isExpired(); }),
-        items.end()
-    );
+    // 이번 틱에 만료 예정인 셀만 확인 (대부분의 틱에서는 아무 일도 하지 않음)
+    auto now = clock.now();
+    if (!expiryScheduler.hasDue(now)) {
+        return;
+    }
+    
+    dueKeys.clear();
+    expiryScheduler.popDue(now, dueKeys);
+    int stride = gameMap.getStride();
+    for (int key : dueKeys) {
+        int x = key % stride;
+        int y = key / stride;
+        // 이미 먹었거나 같은 칸에 새로 생긴 아이템이면 무시
+        auto it = std::find_if(items.begin(), items.end(), [x, y, now](const Item& item) {
+            return item.getX() == x && item.getY() == y && item.isExpired(now);
+        });
+        if (it != items.end()) {
+            items.erase(it);
+            gameMap.markDirty(x, y);
+        }
+    }
 }
 
 // 맵에 아이템 위치 업데이트
@@ -47,42 +75,54 @@ void ItemManager::updateMap() {
     // 먼저 기존 아이템 위치를 맵에서 제거 (값 5, 6, 8을 0으로)
     for (int y = 0; y < gameMap.getHeight(); ++y) {
         for (int x = 0; x < gameMap.getWidth(); ++x) {
-            int cellValue = gameMap.getCell(x, y);
+            uint8_t cellValue = gameMap.getCellUnchecked(x, y);
             if (cellValue == 5 || cellValue == 6 || cellValue == 8) {  // Growth, Poison, Speed Item
-                gameMap.setCell(x, y, 0);  // 빈 공간으로 설정
+                gameMap.setCellUnchecked(x, y, 0);  // 빈 공간으로 설정
             }
         }
     }
     
     // 현재 아이템들을 맵에 표시
     for (const auto& item : items) {
-        int value;
-        switch (item.getType()) {
-            case ItemType::GROWTH:
-                value = 5;
-                break;
-            case ItemType::POISON:
-                value = 6;
-                break;
-            case ItemType::SPEED:
-                value = 8;
-                break;
-            default:
-                value = 0;
-                break;
-        }
-        gameMap.setCell(item.getX(), item.getY(), value);
+        gameMap.setCell(item.getX(), item.getY(), getCellValueForType(item.getType()));
+    }
+}
+
+void ItemManager::clear() {
+    items.clear();
+    expiryScheduler.clear();
+}
+
+void ItemManager::swapState(ItemManager& other) {
+    std::swap(items, other.items);
+    std::swap(expiryScheduler, other.expiryScheduler);
+    std::swap(rng, other.rng);
+}
+
+// 아이템 타입별 맵 값
+int ItemManager::getCellValueForType(ItemType type) {
+    switch (type) {
+        case ItemType::GROWTH:
+            return 5;
+        case ItemType::POISON:
+            return 6;
+        case ItemType::SPEED:
+            return 8;
     }
+    return 0;
 }
 
 // 충돌 감지
 std::optional<Item> ItemManager::checkCollision(const Snake& snake) {
-    Position headPos = snake.getHead();
-    
+    return takeItemAt(snake.getHead());
+}
+
+std::optional<Item> ItemManager::takeItemAt(const Position& pos) {
     for (auto it = items.begin(); it != items.end(); ++it) {
-        if (it->getPosition() == headPos) {
+        if (it->getPosition() == pos) {
             Item collectedItem = *it;
             items.erase(it);
+            gameMap.markDirty(pos.x, pos.y);
             return collectedItem;
         }
     }
@@ -92,14 +132,24 @@ std::optional<Item> ItemManager::checkCollision(const Snake& snake) {
 
 // 빈 공간 찾기
 std::optional<Position> ItemManager::findEmptyPosition(const Snake& snake) {
-    std::uniform_int_distribution<int> xDist(1, gameMap.getWidth() - 2);
-    std::uniform_int_distribution<int> yDist(1, gameMap.getHeight() - 2);
+    int freeCount = gameMap.getFreeCellCount();
+    if (freeCount == 0) {
+        return std::nullopt;
+    }
+    
+    // 맵이 유지하는 빈 셀 목록에서 균등 추출
+    // (맵 반영 전의 뱀 머리/아이템 셀이 섞여 있을 수 있어 검사 후 몇 번 재시도)
+    for (int attempts = 0; attempts < 8; ++attempts) {
+        auto [x, y] = gameMap.getFreeCell(rng.uniformInt(freeCount));
+        if (isPositionValid(x, y, snake)) {
+            return Position(x, y);
+        }
+    }
     
-    // 최대 100번 시도
-    for (int attempts = 0; attempts < 100; ++attempts) {
-        int x = xDist(gen);
-        int y = yDist(gen);
-        
+    // 재시도가 모두 실패하면 임의의 위치부터 빈 셀 목록을 한 바퀴 순회
+    int start = rng.uniformInt(freeCount);
+    for (int i = 0; i < freeCount; ++i) {
+        auto [x, y] = gameMap.getFreeCell((start + i) % freeCount);
         if (isPositionValid(x, y, snake)) {
             return Position(x, y);
         }
@@ -121,17 +171,13 @@ bool ItemManager::isPositionValid(int x, int y, const Snake& snake) const {
     }
     
     // Snake 몸통과 겹치지 않는지 확인
-    Position pos(x, y);
-    const auto& body = snake.getBody();
-    for (const auto& segment : body) {
-        if (segment == pos) {
-            return false;
-        }
+    if (snake.isOccupied(x, y)) {
+        return false;
     }
     
     // 기존 아이템과 겹치지 않는지 확인
     for (const auto& item : items) {
-        if (item.getPosition() == pos) {
+        if (item.getPosition() == Position(x, y)) {
             return false;
         }
     }
@@ -144,14 +190,22 @@ int ItemManager::getItemCount() const {
     return items.size();
 }
 
+int ItemManager::getCellValueAt(int x, int y) const {
+    for (const auto& item : items) {
+        if (item.getX() == x && item.getY() == y) {
+            return getCellValueForType(item.getType());
+        }
+    }
+    return 0;
+}
+
 const std::vector<Item>& ItemManager::getItems() const {
     return items;
 }
 
 // 랜덤 타입 생성
 ItemType ItemManager::getRandomItemType() {
-    std::uniform_int_distribution<int> typeDist(0, 2);  // 0: GROWTH, 1: POISON, 2: SPEED
-    int randomValue = typeDist(gen);
+    int randomValue = rng.uniformInt(3);  // 0: GROWTH, 1: POISON, 2: SPEED
     switch (randomValue) {
         case 0:
             return ItemType::GROWTH;
@@ -162,4 +216,43 @@ ItemType ItemManager::getRandomItemType() {
         default:
             return ItemType::GROWTH;  // 기본값
     }
-} 
\ No newline at end of file
+}
+
+// 스냅샷 저장
+void ItemManager::saveState(StateWriter& out) const {
+    out.writeVarint(items.size());
+    for (const auto& item : items) {
+        out.writeInt(item.getX());
+        out.writeInt(item.getY());
+        out.writeByte(static_cast<uint8_t>(item.getType()));
+        out.writeInt(item.getCreationTime().time_since_epoch().count());
+        out.writeInt((item.getExpiryTime() - item.getCreationTime()).count());
+    }
+    expiryScheduler.saveState(out);
+    rng.saveState(out);
+}
+
+// 스냅샷 복원
+bool ItemManager::loadState(StateReader& in) {
+    size_t count = in.readCount(MAX_ITEMS);
+    items.clear();
+    for (size_t i = 0; i < count && in.ok(); i++) {
+        int x = in.readInt32();
+        int y = in.readInt32();
+        uint8_t type = in.readByte();
+        GameClock::time_point creationTime(GameClock::duration(in.readInt()));
+        std::chrono::milliseconds duration(in.readInt());
+        if (type > static_cast<uint8_t>(ItemType::SPEED)) {
+            in.fail();
+            break;
+        }
+        if (!gameMap.isValidPosition(x, y)) {
+            in.fail();
+            break;
+        }
+        items.emplace_back(x, y, static_cast<ItemType>(type), duration, creationTime);
+    }
+    expiryScheduler.loadState(in, in.remaining() / 2);
+    rng.loadState(in);
+    return in.ok();
+}
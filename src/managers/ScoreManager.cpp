@@ -6,8 +6,7 @@
 
 ScoreManager::ScoreManager() 
     : currentLength(3), maxLength(3), growthItemsCollected(0), 
-      poisonItemsCollected(0), gatesUsed(0) {
-    gameStartTime = std::chrono::steady_clock::now();
+      totalGrowthItemsCollected(0), poisonItemsCollected(0), gatesUsed(0), totalGatesUsed(0), gameStartTime(), currentTime() {
 }
 
 void ScoreManager::updateSnakeLength(int length) {
@@ -25,6 +24,7 @@ int ScoreManager::getMaxLength() const {
 
 void ScoreManager::incrementGrowthItems() {
     growthItemsCollected++;
+    totalGrowthItemsCollected++;
 }
 
 void ScoreManager::incrementPoisonItems() {
@@ -33,12 +33,17 @@ void ScoreManager::incrementPoisonItems() {
 
 void ScoreManager::incrementGatesUsed() {
     gatesUsed++;
+    totalGatesUsed++;
 }
 
 int ScoreManager::getGrowthItemsCollected() const {
     return growthItemsCollected;
 }
 
+int ScoreManager::getTotalGrowthItemsCollected() const {
+    return totalGrowthItemsCollected;
+}
+
 int ScoreManager::getPoisonItemsCollected() const {
     return poisonItemsCollected;
 }
@@ -47,18 +52,25 @@ int ScoreManager::getGatesUsed() const {
     return gatesUsed;
 }
 
+int ScoreManager::getTotalGatesUsed() const {
+    return totalGatesUsed;
+}
+
 // 생존시간 관련 메서드들
 void ScoreManager::setGameStartTime() {
-    gameStartTime = std::chrono::steady_clock::now();
+    gameStartTime = currentTime;
 }
 
-void ScoreManager::setGameStartTime(const std::chrono::steady_clock::time_point& startTime) {
+void ScoreManager::setGameStartTime(const GameClock::time_point& startTime) {
     gameStartTime = startTime;
 }
 
+void ScoreManager::updateGameTime(const GameClock::time_point& now) {
+    currentTime = now;
+}
+
 int ScoreManager::getSurvivalTimeSeconds() const {
-    auto now = std::chrono::steady_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - gameStartTime);
+    auto duration = std::chrono::duration_cast<std::chrono::seconds>(currentTime - gameStartTime);
     return static_cast<int>(duration.count());
 }
 
@@ -105,10 +117,9 @@ void ScoreManager::saveToFile(const std::string& filename) const {
         file << "gates_used=" << gatesUsed << "\n";
         file << "total_score=" << calculateScore() << "\n";
         
-        // 게임 시작 시간을 epoch 이후 밀리초로 저장
-        auto epoch = gameStartTime.time_since_epoch();
-        auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(epoch);
-        file << "game_start_time=" << millis.count() << "\n";
+        // 게임 시작 시간과 현재 게임 시간을 게임 시계 기준 밀리초로 저장
+        file << "game_start_time=" << gameStartTime.time_since_epoch().count() << "\n";
+        file << "current_time=" << currentTime.time_since_epoch().count() << "\n";
         
         file.close();
     }
@@ -137,10 +148,10 @@ void ScoreManager::loadFromFile(const std::string& filename) {
             } else if (key == "gates_used") {
                 gatesUsed = std::stoi(value);
             } else if (key == "game_start_time") {
-                // epoch 이후 밀리초에서 time_point로 복원
-                long long millis = std::stoll(value);
-                auto duration = std::chrono::milliseconds(millis);
-                gameStartTime = std::chrono::steady_clock::time_point(duration);
+                // 게임 시계 기준 밀리초에서 time_point로 복원
+                gameStartTime = GameClock::time_point(std::chrono::milliseconds(std::stoll(value)));
+            } else if (key == "current_time") {
+                currentTime = GameClock::time_point(std::chrono::milliseconds(std::stoll(value)));
             }
         }
     }
@@ -151,9 +162,11 @@ void ScoreManager::reset() {
     currentLength = 3;  // 초기 Snake 길이
     maxLength = 3;
     growthItemsCollected = 0;
+    totalGrowthItemsCollected = 0;
     poisonItemsCollected = 0;
     gatesUsed = 0;
-    gameStartTime = std::chrono::steady_clock::now();  // 시작 시간도 리셋
+    totalGatesUsed = 0;
+    gameStartTime = currentTime;  // 시작 시간도 리셋
 }
 
 void ScoreManager::resetStageSpecificCounters() {
@@ -161,4 +174,30 @@ void ScoreManager::resetStageSpecificCounters() {
     // 현재 길이, 최대 길이, Poison Items는 유지
     growthItemsCollected = 0;
     gatesUsed = 0;
-} 
\ No newline at end of file
+}
+
+// 스냅샷 저장/복원
+void ScoreManager::saveState(StateWriter& out) const {
+    out.writeInt(currentLength);
+    out.writeInt(maxLength);
+    out.writeInt(growthItemsCollected);
+    out.writeInt(totalGrowthItemsCollected);
+    out.writeInt(poisonItemsCollected);
+    out.writeInt(gatesUsed);
+    out.writeInt(totalGatesUsed);
+    out.writeInt(gameStartTime.time_since_epoch().count());
+    out.writeInt(currentTime.time_since_epoch().count());
+}
+
+bool ScoreManager::loadState(StateReader& in) {
+    currentLength = in.readInt32();
+    maxLength = in.readInt32();
+    growthItemsCollected = in.readInt32();
+    totalGrowthItemsCollected = in.readInt32();
+    poisonItemsCollected = in.readInt32();
+    gatesUsed = in.readInt32();
+    totalGatesUsed = in.readInt32();
+    gameStartTime = GameClock::time_point(GameClock::duration(in.readInt()));
+    currentTime = GameClock::time_point(GameClock::duration(in.readInt()));
+    return in.ok();
+}
@@ -1,7 +1,13 @@
 #include "TemporaryWallManager.hpp"
 #include <algorithm>
+#include <utility>
 
-TemporaryWallManager::TemporaryWallManager(GameMap& map) : gameMap(map) {
+TemporaryWallManager::TemporaryWallManager(GameMap& map, const GameClock& clock)
+    : gameMap(map), clock(clock) {
+}
+
+TemporaryWallManager::TemporaryWallManager(const TemporaryWallManager& other, GameMap& map, const GameClock& clock)
+    : gameMap(map), clock(clock), temporaryWalls(other.temporaryWalls), expiryScheduler(other.expiryScheduler) {
 }
 
 TemporaryWallManager::~TemporaryWallManager() {
@@ -18,7 +24,9 @@ void TemporaryWallManager::addTemporaryWall(Position pos, std::chrono::milliseco
     removeWallAt(pos);
     
     // 새로운 임시 벽 추가
-    temporaryWalls.emplace_back(pos, lifetime);
+    temporaryWalls.emplace_back(pos, lifetime, clock.now());
+    expiryScheduler.schedule(pos.y * gameMap.getStride() + pos.x, temporaryWalls.back().getExpiryTime());
+    gameMap.markDirty(pos.x, pos.y);
 }
 
 void TemporaryWallManager::update() {
@@ -36,7 +44,16 @@ void TemporaryWallManager::updateMap() {
 }
 
 void TemporaryWallManager::clear() {
+    for (const auto& wall : temporaryWalls) {
+        gameMap.markDirty(wall.getPosition().x, wall.getPosition().y);
+    }
     temporaryWalls.clear();
+    expiryScheduler.clear();
+}
+
+void TemporaryWallManager::swapState(TemporaryWallManager& other) {
+    std::swap(temporaryWalls, other.temporaryWalls);
+    std::swap(expiryScheduler, other.expiryScheduler);
 }
 
 bool TemporaryWallManager::hasTemporaryWallAt(Position pos) const {
@@ -48,13 +65,27 @@ bool TemporaryWallManager::hasTemporaryWallAt(Position pos) const {
 }
 
 void TemporaryWallManager::removeExpiredWalls() {
-    temporaryWalls.erase(
-        std::remove_if(temporaryWalls.begin(), temporaryWalls.end(),
-            [](const TemporaryWall& wall) {
-                return wall.isExpired();
-            }),
-        temporaryWalls.end()
-    );
+    // 이번 틱에 만료 예정인 셀만 확인
+    auto now = clock.now();
+    if (!expiryScheduler.hasDue(now)) {
+        return;
+    }
+    
+    dueKeys.clear();
+    expiryScheduler.popDue(now, dueKeys);
+    int stride = gameMap.getStride();
+    for (int key : dueKeys) {
+        Position pos(key % stride, key / stride);
+        // 같은 칸에 다시 설치된 벽이면 아직 만료되지 않았으므로 유지
+        auto it = std::find_if(temporaryWalls.begin(), temporaryWalls.end(),
+            [pos, now](const TemporaryWall& wall) {
+                return wall.getPosition() == pos && wall.isExpired(now);
+            });
+        if (it != temporaryWalls.end()) {
+            temporaryWalls.erase(it);
+            gameMap.markDirty(pos.x, pos.y);
+        }
+    }
 }
 
 bool TemporaryWallManager::isValidPosition(Position pos) const {
@@ -70,4 +101,36 @@ void TemporaryWallManager::removeWallAt(Position pos) {
             }),
         temporaryWalls.end()
     );
-} 
\ No newline at end of file
+    gameMap.markDirty(pos.x, pos.y);
+}
+
+void TemporaryWallManager::saveState(StateWriter& out) const {
+    out.writeVarint(temporaryWalls.size());
+    for (const auto& wall : temporaryWalls) {
+        out.writeInt(wall.getX());
+        out.writeInt(wall.getY());
+        out.writeInt(wall.getCreationTime().time_since_epoch().count());
+        out.writeInt(wall.getLifetime().count());
+    }
+    expiryScheduler.saveState(out);
+}
+
+bool TemporaryWallManager::loadState(StateReader& in) {
+    // 벽 하나는 최소 4바이트
+    size_t count = in.readCount(in.remaining() / 4);
+    temporaryWalls.clear();
+    temporaryWalls.reserve(count);
+    for (size_t i = 0; i < count && in.ok(); i++) {
+        int x = in.readInt32();
+        int y = in.readInt32();
+        GameClock::time_point creationTime(GameClock::duration(in.readInt()));
+        std::chrono::milliseconds lifetime(in.readInt());
+        if (!gameMap.isValidPosition(x, y)) {
+            in.fail();
+            break;
+        }
+        temporaryWalls.emplace_back(Position(x, y), lifetime, creationTime);
+    }
+    expiryScheduler.loadState(in, in.remaining() / 2);
+    return in.ok();
+}
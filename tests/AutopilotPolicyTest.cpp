@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include "AutopilotPolicy.hpp"
+
+class AutopilotPolicyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        simulation = new Simulation(31, 31, 42);
+        policy = new AutopilotPolicy();
+    }
+
+    void TearDown() override {
+        delete policy;
+        delete simulation;
+    }
+
+    // 아이템을 놓고 맵에 반영
+    void placeItem(int x, int y, ItemType type) {
+        simulation->getItemManager().addItem(x, y, type);
+        simulation->getItemManager().updateMap();
+    }
+
+    Simulation* simulation;
+    AutopilotPolicy* policy;
+};
+
+// 경로 탐색에서 지나갈 수 있는 칸 판정 테스트
+TEST_F(AutopilotPolicyTest, PassableCellTest) {
+    EXPECT_TRUE(AutopilotPolicy::isPassableCell(0));
+    EXPECT_TRUE(AutopilotPolicy::isPassableCell(5));
+    EXPECT_TRUE(AutopilotPolicy::isPassableCell(8));
+    EXPECT_FALSE(AutopilotPolicy::isPassableCell(1));
+    EXPECT_FALSE(AutopilotPolicy::isPassableCell(4));
+    EXPECT_FALSE(AutopilotPolicy::isPassableCell(6));
+    EXPECT_FALSE(AutopilotPolicy::isPassableCell(7));
+    EXPECT_FALSE(AutopilotPolicy::isPassableCell(9));
+}
+
+// 가장 가까운 Growth 쪽으로 최단 경로 첫 칸을 고르는지 테스트
+TEST_F(AutopilotPolicyTest, HeadsToNearestGrowthTest) {
+    ASSERT_EQ(simulation->getItemManager().getItemCount(), 0);
+    Position head = simulation->getSnake().getHead();
+    placeItem(head.x + 8, head.y, ItemType::GROWTH);
+    placeItem(head.x, head.y - 3, ItemType::GROWTH);
+
+    EXPECT_EQ(policy->chooseAction(*simulation), GameAction::TURN_UP);
+    EXPECT_EQ(policy->getLastPathLength(), 3);
+    // 장애물이 없으면 추정 거리가 정확하므로 경로 위 칸만 확장
+    EXPECT_LE(policy->getLastExpandedCount(), 4);
+}
+
+// 직진 경로면 방향 전환 없이 유지하는지 테스트
+TEST_F(AutopilotPolicyTest, KeepsDirectionOnStraightPathTest) {
+    Position head = simulation->getSnake().getHead();
+    placeItem(head.x + 4, head.y, ItemType::GROWTH);
+
+    EXPECT_EQ(policy->chooseAction(*simulation), GameAction::NONE);
+    EXPECT_EQ(policy->getLastPathLength(), 4);
+}
+
+// Poison과 Temporary Wall을 돌아가는지 테스트
+TEST_F(AutopilotPolicyTest, AvoidsPoisonAndTemporaryWallTest) {
+    Position head = simulation->getSnake().getHead();
+    placeItem(head.x + 4, head.y, ItemType::GROWTH);
+    placeItem(head.x + 1, head.y, ItemType::POISON);
+    simulation->getMap().setCellValue(head.x + 2, head.y - 1, 9);
+
+    GameAction action = policy->chooseAction(*simulation);
+    EXPECT_EQ(action, GameAction::TURN_DOWN);
+    EXPECT_EQ(policy->getLastPathLength(), 6);
+}
+
+// 먹이가 없으면 더 넓은 공간 쪽으로 피하는지 테스트
+TEST_F(AutopilotPolicyTest, SurvivalFallbackPrefersOpenSpaceTest) {
+    Position head = simulation->getSnake().getHead();
+    GameMap& map = simulation->getMap();
+    // 앞은 막고 위쪽은 한 칸짜리 구멍으로 만듦
+    map.setCellValue(head.x + 1, head.y, 1);
+    map.setCellValue(head.x, head.y - 2, 1);
+    map.setCellValue(head.x - 1, head.y - 1, 1);
+    map.setCellValue(head.x + 1, head.y - 1, 1);
+
+    EXPECT_EQ(policy->chooseAction(*simulation), GameAction::TURN_DOWN);
+    EXPECT_EQ(policy->getLastPathLength(), -1);
+}
+
+// 먹이가 뱀이 들어갈 수 없는 좁은 구멍 안에 있으면 포기하는지 테스트
+TEST_F(AutopilotPolicyTest, SkipsGrowthInsideDeadEndTest) {
+    Position head = simulation->getSnake().getHead();
+    GameMap& map = simulation->getMap();
+    map.setCellValue(head.x, head.y - 2, 1);
+    map.setCellValue(head.x - 1, head.y - 1, 1);
+    map.setCellValue(head.x + 1, head.y - 1, 1);
+    placeItem(head.x, head.y - 1, ItemType::GROWTH);
+
+    EXPECT_EQ(policy->chooseAction(*simulation), GameAction::NONE);
+    EXPECT_EQ(policy->getLastPathLength(), 1);
+}
+
+// 닿을 수 없는 Growth는 확장 예산에서 탐색을 멈추고 생존 휴리스틱으로 넘어가는지 테스트
+TEST_F(AutopilotPolicyTest, ExpansionLimitFallsBackToSurvivalTest) {
+    Position head = simulation->getSnake().getHead();
+    GameMap& map = simulation->getMap();
+    int x = head.x + 6;
+    int y = head.y - 6;
+    map.setCellValue(x - 1, y, 1);
+    map.setCellValue(x + 1, y, 1);
+    map.setCellValue(x, y - 1, 1);
+    map.setCellValue(x, y + 1, 1);
+    placeItem(x, y, ItemType::GROWTH);
+
+    // 제한이 없으면 닿을 수 있는 칸을 전부 확장한 뒤에야 포기
+    GameAction unlimited = policy->chooseAction(*simulation);
+    EXPECT_EQ(policy->getLastPathLength(), -1);
+    EXPECT_GT(policy->getLastExpandedCount(), 64);
+
+    AutopilotPolicy limited(AutopilotPolicy::DEFAULT_FLOOD_FILL_LIMIT, 64);
+    EXPECT_EQ(limited.chooseAction(*simulation), unlimited);
+    EXPECT_EQ(limited.getLastPathLength(), -1);
+    EXPECT_EQ(limited.getLastExpandedCount(), 64);
+}
+
+// 맵 칸 수보다 훨씬 작은 칸 표로도 큰 맵에서 최단 경로를 찾는지 테스트
+TEST_F(AutopilotPolicyTest, LargeMapPathTest) {
+    Simulation large(1025, 1025, 42);
+    Position head = large.getSnake().getHead();
+    large.getItemManager().addItem(head.x + 40, head.y - 30, ItemType::GROWTH);
+    large.getItemManager().updateMap();
+    large.getMap().setCellValue(head.x + 1, head.y, 1);
+
+    GameAction action = policy->chooseAction(large);
+    EXPECT_TRUE(action == GameAction::TURN_UP || action == GameAction::TURN_DOWN);
+    EXPECT_EQ(policy->getLastPathLength(), 70);
+
+    // 작은 맵으로 돌아와도 같은 표를 재사용
+    placeItem(head.x % 31, 2, ItemType::GROWTH);
+    policy->chooseAction(*simulation);
+    EXPECT_GT(policy->getLastPathLength(), 0);
+}
+
+// 버퍼를 재사용해도 같은 상태에서 같은 결과인지 테스트 (세대 번호 검증)
+TEST_F(AutopilotPolicyTest, ReusedBuffersGiveSameResultTest) {
+    Position head = simulation->getSnake().getHead();
+    placeItem(head.x - 5, head.y + 6, ItemType::GROWTH);
+
+    GameAction first = policy->chooseAction(*simulation);
+    int firstLength = policy->getLastPathLength();
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(policy->chooseAction(*simulation), first);
+        EXPECT_EQ(policy->getLastPathLength(), firstLength);
+    }
+
+    AutopilotPolicy fresh;
+    EXPECT_EQ(fresh.chooseAction(*simulation), first);
+    EXPECT_EQ(fresh.getLastPathLength(), firstLength);
+}
+
+// 실제 게임에서 오래 살아남으며 Growth를 먹는지 테스트
+TEST_F(AutopilotPolicyTest, PlaysGameTest) {
+    int maxLength = simulation->getSnake().getLength();
+    for (int tick = 0; tick < 500 && !simulation->isGameOver(); tick++) {
+        simulation->applyAction(policy->chooseAction(*simulation));
+        simulation->update();
+        maxLength = std::max(maxLength, simulation->getSnake().getLength());
+    }
+    EXPECT_GE(simulation->getClock().getTickCount(), 300);
+    EXPECT_GT(maxLength, 3);
+}
+
+// Gate 너머의 Growth는 순간이동 간선을 거쳐 직선 거리보다 짧게 찾는지 테스트
+TEST_F(AutopilotPolicyTest, RoutesThroughGateTest) {
+    int routed = 0;
+    for (uint64_t seed = 1; seed <= 20; seed++) {
+        Simulation game(31, 31, seed);
+        game.getGateManager().generateGates(game.getSnake());
+        Position head = game.getSnake().getHead();
+        const GameMap& map = game.getMap();
+
+        for (const TeleportEdge& edge : game.getGateManager().getTeleportEdges()) {
+            auto exit = game.getGateManager().resolveTeleportExit(edge);
+            if (!exit.has_value() || map.getCellValue(edge.from.x, edge.from.y) != 0) continue;
+            int viaGate = std::abs(edge.from.x - head.x) + std::abs(edge.from.y - head.y) + 1;
+            int direct = std::abs(exit->x - head.x) + std::abs(exit->y - head.y);
+            if (direct <= viaGate + 4) continue;
+
+            // 출구 바로 옆 칸에 Growth를 두면 Gate를 지나는 경로가 최단 (출구 칸 자체는 비어 있어야 함)
+            Position item = exit.value();
+            const int dx[] = {0, 0, -1, 1};
+            const int dy[] = {-1, 1, 0, 0};
+            for (int direction = 0; direction < 4; direction++) {
+                if (map.getCellValue(exit->x + dx[direction], exit->y + dy[direction]) == 0) {
+                    item = Position(exit->x + dx[direction], exit->y + dy[direction]);
+                    break;
+                }
+            }
+            ASSERT_NE(item, exit.value());
+            Simulation probe(31, 31, seed);
+            probe.getGateManager().generateGates(probe.getSnake());
+            probe.getItemManager().addItem(item.x, item.y, ItemType::GROWTH);
+            probe.getItemManager().updateMap();
+            AutopilotPolicy autopilot;
+            autopilot.chooseAction(probe);
+            EXPECT_LE(autopilot.getLastPathLength(), viaGate + 1);
+            EXPECT_LT(autopilot.getLastPathLength(), direct - 1);
+            routed++;
+            break;
+        }
+    }
+    EXPECT_GT(routed, 0);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "BatchRunner.hpp"
+#include <memory>
+#include <sstream>
+#include <string>
+
+class BatchRunnerTest : public ::testing::Test {
+protected:
+    static BatchRunner::PolicyFactory safePolicy() {
+        return [](uint64_t seed) -> std::unique_ptr<InputPolicy> {
+            return std::make_unique<SafeMovePolicy>(seed);
+        };
+    }
+
+    static BatchConfig smallConfig(int threads) {
+        BatchConfig config;
+        config.gameCount = 24;
+        config.threadCount = threads;
+        config.baseSeed = 99;
+        config.maxTicks = 2000;
+        return config;
+    }
+};
+
+// 게임별 시드 유도 테스트
+TEST_F(BatchRunnerTest, GameSeedTest) {
+    EXPECT_EQ(BatchRunner::gameSeed(1, 0), BatchRunner::gameSeed(1, 0));
+    EXPECT_NE(BatchRunner::gameSeed(1, 0), BatchRunner::gameSeed(1, 1));
+    EXPECT_NE(BatchRunner::gameSeed(1, 0), BatchRunner::gameSeed(2, 0));
+}
+
+// 같은 시드와 정책이면 같은 게임인지 테스트
+TEST_F(BatchRunnerTest, PlayGameDeterminismTest) {
+    BatchConfig config = smallConfig(1);
+    SafeMovePolicy first(5);
+    SafeMovePolicy second(5);
+
+    GameResult a = BatchRunner::playGame(config, 1234, first);
+    GameResult b = BatchRunner::playGame(config, 1234, second);
+    EXPECT_EQ(a.score, b.score);
+    EXPECT_EQ(a.maxLength, b.maxLength);
+    EXPECT_EQ(a.gatesUsed, b.gatesUsed);
+    EXPECT_EQ(a.survivalTicks, b.survivalTicks);
+    EXPECT_EQ(a.stageReached, b.stageReached);
+}
+
+// 스레드 수와 무관하게 같은 결과인지 테스트
+TEST_F(BatchRunnerTest, ThreadCountIndependentTest) {
+    BatchRunner single(smallConfig(1), safePolicy());
+    BatchRunner parallel(smallConfig(4), safePolicy());
+    const auto& singleResults = single.run();
+    const auto& parallelResults = parallel.run();
+
+    ASSERT_EQ(singleResults.size(), 24u);
+    ASSERT_EQ(parallelResults.size(), 24u);
+    for (size_t i = 0; i < singleResults.size(); i++) {
+        EXPECT_EQ(singleResults[i].seed, parallelResults[i].seed);
+        EXPECT_EQ(singleResults[i].score, parallelResults[i].score);
+        EXPECT_EQ(singleResults[i].survivalTicks, parallelResults[i].survivalTicks);
+        EXPECT_EQ(singleResults[i].stageReached, parallelResults[i].stageReached);
+    }
+}
+
+// 요약 집계 테스트
+TEST_F(BatchRunnerTest, SummarizeTest) {
+    std::vector<GameResult> results(2);
+    results[0].score = 100;
+    results[0].maxLength = 5;
+    results[0].gatesUsed = 1;
+    results[0].survivalTicks = 50;
+    results[0].stageReached = 1;
+    results[1].score = 300;
+    results[1].maxLength = 9;
+    results[1].gatesUsed = 3;
+    results[1].survivalTicks = 150;
+    results[1].stageReached = 2;
+    results[1].completed = true;
+
+    BatchSummary summary = BatchRunner::summarize(results);
+    EXPECT_EQ(summary.gameCount, 2);
+    EXPECT_EQ(summary.completedCount, 1);
+    EXPECT_DOUBLE_EQ(summary.meanScore, 200.0);
+    EXPECT_EQ(summary.bestScore, 300);
+    EXPECT_DOUBLE_EQ(summary.meanMaxLength, 7.0);
+    EXPECT_EQ(summary.bestMaxLength, 9);
+    EXPECT_DOUBLE_EQ(summary.meanGatesUsed, 2.0);
+    EXPECT_DOUBLE_EQ(summary.meanSurvivalTicks, 100.0);
+    EXPECT_EQ(summary.longestSurvivalTicks, 150);
+    EXPECT_EQ(summary.totalTicks, 200);
+    ASSERT_EQ(summary.stageReachedCounts.size(), 3u);
+    EXPECT_EQ(summary.stageReachedCounts[1], 1);
+    EXPECT_EQ(summary.stageReachedCounts[2], 1);
+
+    std::ostringstream out;
+    BatchRunner::writeSummary(out, summary);
+    EXPECT_NE(out.str().find("games"), std::string::npos);
+}
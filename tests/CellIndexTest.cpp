@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "CellIndex.hpp"
+#include <set>
+
+class CellIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        index = new CellIndex(16);
+    }
+
+    void TearDown() override {
+        delete index;
+    }
+
+    CellIndex* index;
+};
+
+// 초기 상태 테스트
+TEST_F(CellIndexTest, InitializationTest) {
+    EXPECT_TRUE(index->empty());
+    EXPECT_EQ(index->size(), 0);
+    EXPECT_FALSE(index->contains(0));
+}
+
+// 추가 및 중복 추가 테스트
+TEST_F(CellIndexTest, InsertTest) {
+    index->insert(3);
+    index->insert(7);
+    index->insert(3);  // 중복은 무시
+
+    EXPECT_EQ(index->size(), 2);
+    EXPECT_TRUE(index->contains(3));
+    EXPECT_TRUE(index->contains(7));
+    EXPECT_FALSE(index->contains(4));
+}
+
+// swap-remove 후에도 나머지 원소가 모두 조회되는지 테스트
+TEST_F(CellIndexTest, EraseTest) {
+    for (int cell = 0; cell < 5; cell++) {
+        index->insert(cell);
+    }
+
+    index->erase(1);  // 중간 원소 삭제
+    index->erase(9);  // 없는 원소 삭제는 무시
+
+    EXPECT_EQ(index->size(), 4);
+    EXPECT_FALSE(index->contains(1));
+
+    std::set<int> remaining;
+    for (size_t slot = 0; slot < index->size(); slot++) {
+        remaining.insert((*index)[slot]);
+    }
+    EXPECT_EQ(remaining, (std::set<int>{0, 2, 3, 4}));
+
+    // 삭제 후 다시 추가 가능
+    index->insert(1);
+    EXPECT_TRUE(index->contains(1));
+    EXPECT_EQ(index->size(), 5);
+}
+
+// 전체 삭제 및 재설정 테스트
+TEST_F(CellIndexTest, ClearAndResetTest) {
+    index->insert(2);
+    index->insert(5);
+    index->clear();
+
+    EXPECT_TRUE(index->empty());
+    EXPECT_FALSE(index->contains(2));
+
+    index->reset(32);
+    index->insert(31);
+    EXPECT_TRUE(index->contains(31));
+    EXPECT_EQ(index->size(), 1);
+}
+
+// 직사각형 영역 채우기가 insert를 차례로 호출한 결과와 같은지 테스트 (추가/삭제를 섞어도 같아야 함)
+TEST_F(CellIndexTest, AssignRectMatchesInsertTest) {
+    const int stride = 12;
+    CellIndex explicitIndex(stride * 10);
+    for (int y = 2; y < 9; y++) {
+        for (int x = 1; x < 11; x++) {
+            explicitIndex.insert(y * stride + x);
+        }
+    }
+    index->assignRect(stride * 10, stride, 1, 2, 10, 7);
+
+    ASSERT_EQ(index->size(), explicitIndex.size());
+    EXPECT_FALSE(index->contains(1 * stride + 5));   // 영역 위
+    EXPECT_FALSE(index->contains(5 * stride + 11));  // 영역 오른쪽
+    EXPECT_TRUE(index->contains(8 * stride + 10));
+
+    uint32_t state = 7;
+    for (int step = 0; step < 2000; step++) {
+        state = state * 1103515245u + 12345u;
+        int cell = static_cast<int>((state >> 8) % (stride * 10));
+        if (state & 0x10000) {
+            index->insert(cell);
+            explicitIndex.insert(cell);
+        } else {
+            index->erase(cell);
+            explicitIndex.erase(cell);
+        }
+        ASSERT_EQ(index->size(), explicitIndex.size());
+        ASSERT_EQ(index->contains(cell), explicitIndex.contains(cell));
+    }
+    for (size_t slot = 0; slot < index->size(); slot++) {
+        ASSERT_EQ((*index)[slot], explicitIndex[slot]) << slot;
+    }
+}
+
+// 직사각형 영역 채우기 상태를 스냅샷으로 저장/복원할 수 있는지 테스트
+TEST_F(CellIndexTest, AssignRectSnapshotTest) {
+    index->assignRect(16, 4, 1, 1, 2, 2);  // 셀 5, 6, 9, 10
+    index->erase(6);
+
+    std::vector<uint8_t> bytes;
+    StateWriter writer(bytes);
+    index->saveState(writer);
+
+    CellIndex restored(16);
+    StateReader reader(bytes.data(), bytes.size());
+    ASSERT_TRUE(restored.loadState(reader));
+    ASSERT_EQ(restored.size(), 3);
+    for (size_t slot = 0; slot < restored.size(); slot++) {
+        EXPECT_EQ(restored[slot], (*index)[slot]);
+    }
+    EXPECT_FALSE(restored.contains(6));
+}
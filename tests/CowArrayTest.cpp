@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "CowArray.hpp"
+#include <cstdint>
+
+class CowArrayTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        array = new CowArray<int, 4>(100, 7);  // 16개씩 7개 청크
+    }
+
+    void TearDown() override {
+        delete array;
+    }
+
+    CowArray<int, 4>* array;
+};
+
+// 초기값과 청크 구성 테스트
+TEST_F(CowArrayTest, InitializationTest) {
+    EXPECT_EQ(array->size(), 100u);
+    EXPECT_EQ(array->getChunkCount(), 7u);
+    EXPECT_EQ(array->getChunkLength(6), 4u);
+    for (size_t i = 0; i < array->size(); i++) {
+        EXPECT_EQ((*array)[i], 7);
+    }
+
+    // 같은 값으로 채운 청크는 처음 쓸 때까지 하나를 공유
+    EXPECT_EQ(array->getOwnedChunkCount(), 0u);
+    array->write(20) = 1;
+    EXPECT_EQ(array->getOwnedChunkCount(), 1u);
+    EXPECT_EQ((*array)[20], 1);
+    EXPECT_EQ((*array)[21], 7);
+    EXPECT_EQ((*array)[40], 7);
+}
+
+// 복사본에 쓰면 그 청크만 복제되고 원본은 그대로인지 테스트
+TEST_F(CowArrayTest, CopyOnWriteTest) {
+    for (size_t i = 0; i < array->size(); i++) {
+        array->write(i) = static_cast<int>(i);
+    }
+    EXPECT_EQ(array->getOwnedChunkCount(), 7u);
+
+    CowArray<int, 4> copy = *array;
+    EXPECT_EQ(array->getOwnedChunkCount(), 0u);
+    EXPECT_EQ(copy.getOwnedChunkCount(), 0u);
+
+    copy.write(35) = -1;
+    EXPECT_EQ(copy[35], -1);
+    EXPECT_EQ((*array)[35], 35);
+    EXPECT_EQ(copy.getOwnedChunkCount(), 1u);
+    EXPECT_EQ(array->getOwnedChunkCount(), 1u);  // 공유가 풀린 청크는 원본도 단독 소유
+
+    // 원본 쪽 쓰기도 복사본에 보이지 않아야 함
+    array->write(70) = -2;
+    EXPECT_EQ(copy[70], 70);
+    EXPECT_EQ((*array)[70], -2);
+}
+
+// 같은 값을 쓰면 복제하지 않는지 테스트
+TEST_F(CowArrayTest, SetSameValueKeepsSharingTest) {
+    CowArray<int, 4> copy = *array;
+    copy.set(10, 7);
+    EXPECT_EQ(copy.getOwnedChunkCount(), 0u);
+    copy.set(10, 8);
+    EXPECT_EQ(copy[10], 8);
+    EXPECT_EQ((*array)[10], 7);
+}
+
+// 끝 추가/제거가 청크 경계를 넘나드는지 테스트
+TEST_F(CowArrayTest, PushPopTest) {
+    CowArray<uint16_t, 4> list;
+    for (int i = 0; i < 40; i++) {
+        list.push_back(static_cast<uint16_t>(i));
+    }
+    EXPECT_EQ(list.size(), 40u);
+    EXPECT_EQ(list.getChunkCount(), 3u);
+    EXPECT_EQ(list.back(), 39);
+
+    CowArray<uint16_t, 4> copy = list;
+    for (int i = 0; i < 25; i++) {
+        copy.pop_back();
+    }
+    EXPECT_EQ(copy.size(), 15u);
+    EXPECT_EQ(copy.getChunkCount(), 1u);
+    copy.push_back(100);
+    copy.push_back(101);
+    EXPECT_EQ(copy[16], 101);
+    EXPECT_EQ(list[16], 16);
+    EXPECT_EQ(list.size(), 40u);
+
+    copy.clear();
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(list.back(), 39);
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "DistanceFieldCache.hpp"
+#include "InputPolicy.hpp"
+
+class DistanceFieldCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        simulation = new Simulation(31, 31, 42);
+        cache = new DistanceFieldCache(*simulation);
+    }
+
+    void TearDown() override {
+        delete cache;
+        delete simulation;
+    }
+
+    // 아이템을 놓고 맵에 반영
+    void placeItem(int x, int y, ItemType type) {
+        simulation->getItemManager().addItem(x, y, type);
+        simulation->getItemManager().updateMap();
+    }
+
+    // 증분 보정한 캐시가 새로 계산한 캐시와 모든 칸에서 같은지 확인
+    void expectMatchesFreshCache() {
+        DistanceFieldCache fresh(*simulation);
+        ASSERT_EQ(cache->getFieldCount(), fresh.getFieldCount());
+        const GameMap& map = simulation->getMap();
+        std::vector<Position> targets;
+        for (const Item& item : simulation->getItemManager().getItems()) {
+            targets.push_back(item.getPosition());
+        }
+        for (const Gate& gate : simulation->getGateManager().getGates()) {
+            targets.push_back(gate.getPosition());
+        }
+        for (const Position& target : targets) {
+            ASSERT_TRUE(cache->hasTarget(target.x, target.y));
+            for (int y = 0; y < map.getHeight(); y++) {
+                for (int x = 0; x < map.getWidth(); x++) {
+                    ASSERT_EQ(cache->getDistance(target.x, target.y, x, y),
+                              fresh.getDistance(target.x, target.y, x, y))
+                        << "target (" << target.x << ", " << target.y << ") cell (" << x << ", " << y << ")";
+                }
+            }
+        }
+    }
+
+    Simulation* simulation;
+    DistanceFieldCache* cache;
+};
+
+// 열린 칸 판정 테스트
+TEST_F(DistanceFieldCacheTest, OpenCellTest) {
+    EXPECT_TRUE(DistanceFieldCache::isOpenCell(0));
+    EXPECT_TRUE(DistanceFieldCache::isOpenCell(5));
+    EXPECT_TRUE(DistanceFieldCache::isOpenCell(8));
+    EXPECT_FALSE(DistanceFieldCache::isOpenCell(1));
+    EXPECT_FALSE(DistanceFieldCache::isOpenCell(3));
+    EXPECT_FALSE(DistanceFieldCache::isOpenCell(6));
+    EXPECT_FALSE(DistanceFieldCache::isOpenCell(7));
+    EXPECT_FALSE(DistanceFieldCache::isOpenCell(9));
+}
+
+// 아이템이 생기면 거리장이 추가되고 거리를 조회할 수 있는지 테스트
+TEST_F(DistanceFieldCacheTest, ItemDistanceTest) {
+    ASSERT_EQ(cache->getFieldCount(), 0);
+    Position head = simulation->getSnake().getHead();
+    placeItem(head.x + 3, head.y - 4, ItemType::GROWTH);
+    cache->sync();
+
+    EXPECT_EQ(cache->getFieldCount(), 1);
+    EXPECT_FALSE(cache->wasLastSyncFull());
+    EXPECT_EQ(cache->getDistance(head.x + 3, head.y - 4, head.x + 3, head.y - 4), 0);
+    EXPECT_EQ(cache->getDistance(head.x + 3, head.y - 4, 1, 1), (head.x + 2) + (head.y - 5));
+    // 막힌 뱀 머리 칸은 인접한 열린 칸을 거친 거리
+    EXPECT_EQ(cache->getDistance(head.x + 3, head.y - 4, head.x, head.y), 7);
+    EXPECT_EQ(cache->getNearestDistance(5, head.x, head.y), 7);
+    EXPECT_EQ(cache->getNearestDistance(8, head.x, head.y), DistanceFieldCache::UNREACHABLE);
+    EXPECT_EQ(cache->getDistance(1, 1, head.x, head.y), DistanceFieldCache::UNREACHABLE);
+}
+
+// 벽이 생기면 돌아가는 거리로, 없어지면 원래 거리로 보정되는지 테스트
+TEST_F(DistanceFieldCacheTest, WallRepairTest) {
+    placeItem(15, 5, ItemType::GROWTH);
+    cache->sync();
+    ASSERT_EQ(cache->getDistance(15, 5, 15, 9), 4);
+
+    GameMap& map = simulation->getMap();
+    for (int x = 12; x <= 18; x++) {
+        map.setCellValue(x, 7, 9);
+    }
+    cache->sync();
+    EXPECT_FALSE(cache->wasLastSyncFull());
+    EXPECT_EQ(cache->getDistance(15, 5, 15, 9), 12);
+    expectMatchesFreshCache();
+
+    map.setCellValue(15, 7, 0);
+    cache->sync();
+    EXPECT_EQ(cache->getDistance(15, 5, 15, 9), 4);
+    expectMatchesFreshCache();
+
+    // 완전히 둘러싸면 도달 불가
+    map.setCellValue(15, 7, 9);
+    map.setCellValue(14, 5, 1);
+    map.setCellValue(16, 5, 1);
+    map.setCellValue(15, 4, 1);
+    map.setCellValue(15, 6, 1);
+    cache->sync();
+    EXPECT_EQ(cache->getDistance(15, 5, 15, 9), DistanceFieldCache::UNREACHABLE);
+    expectMatchesFreshCache();
+}
+
+// 사라진 목표의 거리장이 제거되는지 테스트
+TEST_F(DistanceFieldCacheTest, RemovedTargetTest) {
+    placeItem(5, 5, ItemType::GROWTH);
+    placeItem(25, 25, ItemType::POISON);
+    cache->sync();
+    ASSERT_EQ(cache->getFieldCount(), 2);
+
+    // 만료 시각이 지나도록 진행
+    for (int tick = 0; tick < 60 && !simulation->isGameOver(); tick++) {
+        simulation->applyAction(tick % 8 < 4 ? GameAction::TURN_UP : GameAction::TURN_RIGHT);
+        simulation->update();
+    }
+    cache->sync();
+    EXPECT_FALSE(cache->hasTarget(5, 5));
+    EXPECT_FALSE(cache->hasTarget(25, 25));
+    expectMatchesFreshCache();
+}
+
+// 게임을 진행하면서 매 틱 증분 보정한 결과가 전체 계산과 같은지 테스트
+TEST_F(DistanceFieldCacheTest, IncrementalMatchesRebuildTest) {
+    SafeMovePolicy policy(7, 20);
+    int incrementalSyncs = 0;
+    for (int tick = 0; tick < 300 && !simulation->isGameOver(); tick++) {
+        simulation->applyAction(policy.chooseAction(*simulation));
+        if (tick % 25 == 0) {
+            simulation->createRandomTemporaryWalls();
+        }
+        simulation->update();
+        cache->sync();
+        incrementalSyncs += cache->wasLastSyncFull() ? 0 : 1;
+        expectMatchesFreshCache();
+        if (HasFatalFailure()) return;
+    }
+    EXPECT_GE(simulation->getClock().getTickCount(), 100);
+    EXPECT_GT(incrementalSyncs, 0);
+}
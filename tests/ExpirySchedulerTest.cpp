@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "ExpiryScheduler.hpp"
+#include <chrono>
+#include <vector>
+
+class ExpirySchedulerTest : public ::testing::Test {
+protected:
+    static GameClock::time_point at(int millis) {
+        return GameClock::time_point(std::chrono::milliseconds(millis));
+    }
+
+    ExpiryScheduler scheduler;
+};
+
+// 초기 상태 테스트
+TEST_F(ExpirySchedulerTest, InitializationTest) {
+    EXPECT_TRUE(scheduler.empty());
+    EXPECT_FALSE(scheduler.hasDue(at(1000000)));
+}
+
+// 만료 시각 순서대로 꺼내는지 테스트
+TEST_F(ExpirySchedulerTest, PopDueOrderTest) {
+    scheduler.schedule(3, at(300));
+    scheduler.schedule(1, at(100));
+    scheduler.schedule(2, at(200));
+    scheduler.schedule(4, at(400));
+
+    std::vector<int> due;
+    scheduler.popDue(at(50), due);
+    EXPECT_TRUE(due.empty());
+
+    scheduler.popDue(at(250), due);
+    EXPECT_EQ(due, (std::vector<int>{1, 2}));
+    EXPECT_EQ(scheduler.size(), 2);
+
+    // 만료 시각과 같은 시점에도 만료로 처리
+    due.clear();
+    scheduler.popDue(at(300), due);
+    EXPECT_EQ(due, (std::vector<int>{3}));
+    EXPECT_FALSE(scheduler.hasDue(at(399)));
+    EXPECT_TRUE(scheduler.hasDue(at(400)));
+}
+
+// 같은 키를 여러 번 등록하면 각각 꺼내지는지 테스트 (지연 취소)
+TEST_F(ExpirySchedulerTest, DuplicateKeyTest) {
+    scheduler.schedule(7, at(100));
+    scheduler.schedule(7, at(500));
+
+    std::vector<int> due;
+    scheduler.popDue(at(100), due);
+    EXPECT_EQ(due, (std::vector<int>{7}));
+    EXPECT_EQ(scheduler.size(), 1);
+
+    scheduler.clear();
+    EXPECT_TRUE(scheduler.empty());
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "FixedTimestepScheduler.hpp"
+#include <chrono>
+
+class FixedTimestepSchedulerTest : public ::testing::Test {
+protected:
+    static FixedTimestepScheduler::time_point at(int millis) {
+        return FixedTimestepScheduler::time_point(std::chrono::milliseconds(millis));
+    }
+
+    // now 시각에 프레임을 시작하고 실행된 틱 수 반환
+    static int runFrame(FixedTimestepScheduler& scheduler, int millis) {
+        scheduler.beginFrame(at(millis));
+        int ticks = 0;
+        while (scheduler.consumeTick()) {
+            ticks++;
+        }
+        return ticks;
+    }
+
+    FixedTimestepScheduler scheduler{5, 5};
+};
+
+// 마감 전에는 틱이 실행되지 않는지 테스트
+TEST_F(FixedTimestepSchedulerTest, NoTickBeforeDeadlineTest) {
+    scheduler.start(at(0), std::chrono::milliseconds(200));
+    EXPECT_EQ(scheduler.getNextDeadline(), at(200));
+
+    EXPECT_EQ(runFrame(scheduler, 199), 0);
+    EXPECT_EQ(scheduler.getTickCount(), 0);
+}
+
+// 늦게 깨어나도 마감 시각이 정확한 배수로 진행되는지 테스트
+TEST_F(FixedTimestepSchedulerTest, DeadlineAdvancesByExactMultiplesTest) {
+    scheduler.start(at(0), std::chrono::milliseconds(200));
+
+    // 15ms 늦게 깨어남 - 다음 마감은 415가 아닌 400
+    EXPECT_EQ(runFrame(scheduler, 215), 1);
+    EXPECT_EQ(scheduler.getNextDeadline(), at(400));
+
+    EXPECT_EQ(runFrame(scheduler, 403), 1);
+    EXPECT_EQ(scheduler.getNextDeadline(), at(600));
+}
+
+// 밀린 틱을 따라잡는지 테스트
+TEST_F(FixedTimestepSchedulerTest, CatchUpTest) {
+    scheduler.start(at(0), std::chrono::milliseconds(100));
+
+    // 350ms 멈춤 - 100, 200, 300 세 틱 실행
+    EXPECT_EQ(runFrame(scheduler, 350), 3);
+    EXPECT_EQ(scheduler.getNextDeadline(), at(400));
+    EXPECT_EQ(scheduler.getDroppedTicks(), 0);
+}
+
+// 오래 멈춘 뒤에는 따라잡는 틱 수가 제한되는지 테스트
+TEST_F(FixedTimestepSchedulerTest, BoundedCatchUpTest) {
+    scheduler.start(at(0), std::chrono::milliseconds(100));
+
+    // 2050ms 멈춤 - 20틱 밀렸지만 최근 5틱만 실행
+    EXPECT_EQ(runFrame(scheduler, 2050), 5);
+    EXPECT_EQ(scheduler.getDroppedTicks(), 15);
+    EXPECT_EQ(scheduler.getNextDeadline(), at(2100));
+
+    // 이후에는 정상 주기로 복귀
+    EXPECT_EQ(runFrame(scheduler, 2100), 1);
+    EXPECT_EQ(scheduler.getNextDeadline(), at(2200));
+}
+
+// 틱 길이 변경이 다음 마감부터 적용되는지 테스트
+TEST_F(FixedTimestepSchedulerTest, SpeedChangeAppliesAtNextDeadlineTest) {
+    scheduler.start(at(0), std::chrono::milliseconds(200));
+
+    scheduler.beginFrame(at(205));
+    EXPECT_TRUE(scheduler.consumeTick());
+    // 이 틱에서 속도 부스트 발생
+    scheduler.setTickDuration(std::chrono::milliseconds(150));
+    EXPECT_FALSE(scheduler.consumeTick());
+
+    // 다음 마감은 방금 실행한 틱의 마감(200) + 150
+    EXPECT_EQ(scheduler.getNextDeadline(), at(350));
+    EXPECT_EQ(runFrame(scheduler, 350), 1);
+    EXPECT_EQ(scheduler.getNextDeadline(), at(500));
+}
+
+// 틱 처리가 늦어 다음 마감이 지났으면 렌더 프레임을 먼저 건너뛰는지 테스트
+TEST_F(FixedTimestepSchedulerTest, RenderDroppedBeforeTicksTest) {
+    scheduler.start(at(0), std::chrono::milliseconds(100));
+
+    // 틱 처리가 빨리 끝나면 그림
+    EXPECT_EQ(runFrame(scheduler, 100), 1);
+    EXPECT_TRUE(scheduler.shouldRender(at(110)));
+
+    // 틱 처리에 오래 걸려 다음 마감(300)이 지났으면 그리기를 건너뜀
+    EXPECT_EQ(runFrame(scheduler, 200), 1);
+    EXPECT_FALSE(scheduler.shouldRender(at(305)));
+    EXPECT_EQ(scheduler.getDroppedFrames(), 1);
+
+    // 틱은 버리지 않고 다음 프레임에 실행
+    EXPECT_EQ(runFrame(scheduler, 305), 1);
+    EXPECT_TRUE(scheduler.shouldRender(at(310)));
+    EXPECT_EQ(scheduler.getDroppedTicks(), 0);
+}
+
+// 계속 밀려 있어도 일정 횟수마다는 그리는지 테스트
+TEST_F(FixedTimestepSchedulerTest, RenderNotStarvedTest) {
+    FixedTimestepScheduler limited(5, 3);
+    limited.start(at(0), std::chrono::milliseconds(100));
+
+    int rendered = 0;
+    for (int frame = 1; frame <= 8; frame++) {
+        // 매 프레임 틱 처리에 한 틱 이상 걸림
+        runFrame(limited, frame * 100);
+        if (limited.shouldRender(at(frame * 100 + 150))) {
+            rendered++;
+        }
+    }
+    EXPECT_EQ(rendered, 2);
+    EXPECT_EQ(limited.getDroppedFrames(), 6);
+}
+
+// 틱 속도와 지터 측정 테스트
+TEST_F(FixedTimestepSchedulerTest, StatisticsTest) {
+    scheduler.start(at(0), std::chrono::milliseconds(100));
+
+    // 매 틱 4ms 늦게 실행
+    for (int tick = 1; tick <= 10; tick++) {
+        runFrame(scheduler, tick * 100 + 4);
+    }
+    EXPECT_EQ(scheduler.getTickCount(), 10);
+
+    // 1초가 지난 프레임(1004ms)에서 직전 구간의 9틱으로 갱신
+    EXPECT_NEAR(scheduler.getAchievedTickRate(), 9 / 1.004, 0.001);
+    EXPECT_NEAR(scheduler.getJitterMs(), 4.0, 0.001);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "FrameBuffer.hpp"
+#include <vector>
+
+class FrameBufferTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        buffer.resize(5, 3);
+    }
+
+    // 모든 칸을 같은 값으로 채우기
+    void fill(char glyph, short colorPair) {
+        for (int y = 0; y < buffer.getHeight(); y++) {
+            for (int x = 0; x < buffer.getWidth(); x++) {
+                buffer.setCell(x, y, glyph, colorPair);
+            }
+        }
+    }
+
+    FrameBuffer buffer;
+};
+
+// 첫 프레임은 행마다 전체를 그림
+TEST_F(FrameBufferTest, FirstFrameFullRedrawTest) {
+    fill('.', 0);
+
+    std::vector<FrameRun> runs;
+    buffer.diff(runs);
+
+    ASSERT_EQ(runs.size(), 3);  // 행마다 하나의 묶음
+    EXPECT_EQ(runs[0].x, 0);
+    EXPECT_EQ(runs[0].y, 0);
+    EXPECT_EQ(runs[0].text, ".....");
+}
+
+// 바뀌지 않은 프레임은 아무것도 그리지 않음
+TEST_F(FrameBufferTest, UnchangedFrameTest) {
+    fill('.', 0);
+    std::vector<FrameRun> runs;
+    buffer.diff(runs);
+
+    runs.clear();
+    fill('.', 0);
+    buffer.diff(runs);
+    EXPECT_TRUE(runs.empty());
+}
+
+// 바뀐 칸만 같은 색상끼리 묶어서 그림
+TEST_F(FrameBufferTest, ChangedCellRunsTest) {
+    fill('.', 0);
+    std::vector<FrameRun> runs;
+    buffer.diff(runs);
+    runs.clear();
+
+    buffer.setCell(1, 1, 'o', 4);
+    buffer.setCell(2, 1, 'o', 4);
+    buffer.setCell(3, 1, '@', 3);  // 색상이 달라 새 묶음
+    buffer.setCell(0, 2, '#', 1);
+    buffer.diff(runs);
+
+    ASSERT_EQ(runs.size(), 3);
+    EXPECT_EQ(runs[0].x, 1);
+    EXPECT_EQ(runs[0].y, 1);
+    EXPECT_EQ(runs[0].colorPair, 4);
+    EXPECT_EQ(runs[0].text, "oo");
+    EXPECT_EQ(runs[1].x, 3);
+    EXPECT_EQ(runs[1].colorPair, 3);
+    EXPECT_EQ(runs[1].text, "@");
+    EXPECT_EQ(runs[2].y, 2);
+    EXPECT_EQ(runs[2].text, "#");
+
+    // 같은 내용이면 다음 프레임에는 그리지 않음
+    runs.clear();
+    buffer.diff(runs);
+    EXPECT_TRUE(runs.empty());
+}
+
+// invalidate 후에는 전체를 다시 그림
+TEST_F(FrameBufferTest, InvalidateTest) {
+    fill('.', 0);
+    std::vector<FrameRun> runs;
+    buffer.diff(runs);
+    runs.clear();
+
+    buffer.invalidate();
+    buffer.diff(runs);
+    EXPECT_EQ(runs.size(), 3);
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include "GameClock.hpp"
+
+class GameClockTest : public ::testing::Test {
+protected:
+    GameClock clock;
+};
+
+// 초기 상태 테스트
+TEST_F(GameClockTest, InitialStateTest) {
+    EXPECT_EQ(clock.now().time_since_epoch().count(), 0);
+    EXPECT_EQ(clock.getTickCount(), 0);
+}
+
+// 시계 진행 테스트
+TEST_F(GameClockTest, AdvanceTest) {
+    clock.advance(std::chrono::milliseconds(200));
+    clock.advance(std::chrono::milliseconds(166));
+
+    EXPECT_EQ(clock.now().time_since_epoch(), std::chrono::milliseconds(366));
+    EXPECT_EQ(clock.getTickCount(), 2);
+}
+
+// 시계 초기화 테스트
+TEST_F(GameClockTest, ResetTest) {
+    clock.advance(std::chrono::seconds(5));
+    clock.reset();
+
+    EXPECT_EQ(clock.now(), GameClock::time_point());
+    EXPECT_EQ(clock.getTickCount(), 0);
+}
+
+// 시간 차이 계산 테스트
+TEST_F(GameClockTest, ElapsedTimeTest) {
+    auto start = clock.now();
+    for (int i = 0; i < 50; i++) {
+        clock.advance(std::chrono::milliseconds(200));
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(clock.now() - start);
+    EXPECT_EQ(elapsed.count(), 10);
+}
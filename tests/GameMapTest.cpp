@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "GameMap.hpp"
+#include <vector>
 
 class GameMapTest : public ::testing::Test {
 protected:
@@ -161,4 +162,81 @@ TEST_F(GameMapTest, TemporaryWallSetterTest) {
     
     EXPECT_EQ(map->getCellValue(5, 10), 9);
     EXPECT_EQ(map->getCellValue(20, 25), 9);
-} 
\ No newline at end of file
+} 
+// 경계 검사 없는 접근자와 연속 저장 배열 테스트
+TEST_F(GameMapTest, UncheckedAccessTest) {
+    map->setCellUnchecked(5, 7, 4);
+    EXPECT_EQ(map->getCellUnchecked(5, 7), 4);
+    EXPECT_EQ(map->getCellValue(5, 7), 4);
+
+    // 행 우선 인덱스로 저장되어야 함
+    EXPECT_EQ(map->getStride(), 31);
+    EXPECT_EQ(map->getCellAt(7 * map->getStride() + 5), 4);
+    EXPECT_EQ(map->getCellAt(0), 2);  // 좌상단 Immune Wall
+    std::vector<uint8_t> copied(31 * 31);
+    map->copyCellsTo(copied.data());
+    EXPECT_EQ(copied[7 * 31 + 5], 4);
+
+    // 검사 있는 setter로 설정한 값도 동일하게 보여야 함
+    map->setCellValue(30, 30, 7);
+    EXPECT_EQ(map->getCellUnchecked(30, 30), 7);
+}
+
+// 빈 셀 인덱스 동기화 테스트
+TEST_F(GameMapTest, FreeCellIndexTest) {
+    // 31x31 맵의 내부 29x29 셀이 모두 비어 있음
+    EXPECT_EQ(map->getFreeCellCount(), 29 * 29);
+
+    map->setWall(5, 5);
+    map->setCellUnchecked(6, 6, 5);
+    EXPECT_EQ(map->getFreeCellCount(), 29 * 29 - 2);
+
+    // 값이 0이 아닌 셀끼리 바뀌면 개수는 그대로
+    map->setCellValue(5, 5, 7);
+    EXPECT_EQ(map->getFreeCellCount(), 29 * 29 - 2);
+
+    // 다시 비우면 인덱스로 복귀
+    map->setCellValue(6, 6, 0);
+    EXPECT_EQ(map->getFreeCellCount(), 29 * 29 - 1);
+
+    // 인덱스의 모든 셀은 실제로 비어 있는 내부 셀이어야 함
+    for (int slot = 0; slot < map->getFreeCellCount(); slot++) {
+        auto [x, y] = map->getFreeCell(slot);
+        EXPECT_EQ(map->getCellValue(x, y), 0);
+        EXPECT_TRUE(x > 0 && x < 30 && y > 0 && y < 30);
+    }
+}
+
+// 위치별 벽 셀 인덱스 테스트
+TEST_F(GameMapTest, WallCellIndexTest) {
+    // 테두리 벽은 모서리를 제외하고 각 변에 29칸씩
+    EXPECT_EQ(map->getWallCells(WallSide::TOP).size(), 29);
+    EXPECT_EQ(map->getWallCells(WallSide::BOTTOM).size(), 29);
+    EXPECT_EQ(map->getWallCells(WallSide::LEFT).size(), 29);
+    EXPECT_EQ(map->getWallCells(WallSide::RIGHT).size(), 29);
+    EXPECT_EQ(map->getWallCells(WallSide::INNER).size(), 0);
+
+    EXPECT_EQ(map->getWallSide(5, 0), WallSide::TOP);
+    EXPECT_EQ(map->getWallSide(30, 7), WallSide::RIGHT);
+    EXPECT_EQ(map->getWallSide(10, 10), WallSide::INNER);
+
+    // 내부 벽 추가
+    map->setWall(10, 10);
+    map->setWall(11, 10);
+    EXPECT_EQ(map->getWallCells(WallSide::INNER).size(), 2);
+
+    // Gate(7)로 바뀌면 후보에서 빠지고, 벽으로 복원되면 다시 포함
+    map->setGate(10, 10);
+    map->setGate(5, 0);
+    EXPECT_EQ(map->getWallCells(WallSide::INNER).size(), 1);
+    EXPECT_EQ(map->getWallCells(WallSide::TOP).size(), 28);
+
+    map->setWall(10, 10);
+    map->setCellValue(5, 0, 2);
+    EXPECT_EQ(map->getWallCells(WallSide::INNER).size(), 2);
+    EXPECT_EQ(map->getWallCells(WallSide::TOP).size(), 29);
+
+    // 벽 종류만 바뀌는 경우(1 -> 2)는 개수 변화 없음
+    map->setCellValue(11, 10, 2);
+    EXPECT_EQ(map->getWallCells(WallSide::INNER).size(), 2);
+}
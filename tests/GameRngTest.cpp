@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "GameRng.hpp"
+#include <algorithm>
+#include <array>
+#include <vector>
+
+class GameRngTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        rng = new GameRng(42);
+    }
+
+    void TearDown() override {
+        delete rng;
+    }
+
+    GameRng* rng;
+};
+
+// 같은 시드면 같은 수열인지 테스트
+TEST_F(GameRngTest, DeterminismTest) {
+    GameRng other(42);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(rng->next(), other.next());
+    }
+
+    GameRng different(43);
+    GameRng same(42);
+    EXPECT_NE(different.next(), same.next());
+}
+
+// 다시 시드를 주면 처음부터 반복되는지 테스트
+TEST_F(GameRngTest, ReseedTest) {
+    uint64_t first = rng->next();
+    rng->next();
+    rng->seed(42);
+    EXPECT_EQ(rng->next(), first);
+}
+
+// 갈라진 스트림이 서로 독립적이고 부모를 진행시키지 않는지 테스트
+TEST_F(GameRngTest, SplitTest) {
+    GameRng copy = *rng;
+    GameRng streamA = rng->split(1);
+    GameRng streamB = rng->split(2);
+    GameRng streamAAgain = rng->split(1);
+
+    EXPECT_EQ(rng->next(), copy.next());
+    EXPECT_NE(streamA.next(), streamB.next());
+
+    GameRng freshA = GameRng(42).split(1);
+    streamAAgain.next();
+    freshA.next();
+    EXPECT_EQ(streamAAgain.next(), freshA.next());
+}
+
+// 범위와 분포 테스트
+TEST_F(GameRngTest, UniformIntTest) {
+    std::array<int, 7> counts{};
+    const int draws = 70000;
+    for (int i = 0; i < draws; i++) {
+        int value = rng->uniformInt(7);
+        ASSERT_GE(value, 0);
+        ASSERT_LT(value, 7);
+        counts[value]++;
+    }
+    for (int count : counts) {
+        EXPECT_NEAR(count, draws / 7, draws / 7 * 0.05);
+    }
+
+    for (int i = 0; i < 1000; i++) {
+        int value = rng->uniformInt(-3, 3);
+        EXPECT_GE(value, -3);
+        EXPECT_LE(value, 3);
+    }
+    EXPECT_EQ(rng->uniformInt(1), 0);
+}
+
+// 확률 테스트
+TEST_F(GameRngTest, ChanceTest) {
+    int hits = 0;
+    for (int i = 0; i < 10000; i++) {
+        hits += rng->chance(25) ? 1 : 0;
+    }
+    EXPECT_NEAR(hits, 2500, 250);
+
+    EXPECT_FALSE(rng->chance(0));
+    EXPECT_TRUE(rng->chance(100));
+}
+
+// 표준 알고리즘과 함께 사용 테스트
+TEST_F(GameRngTest, StandardShuffleTest) {
+    std::vector<int> values = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::shuffle(values.begin(), values.end(), *rng);
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(values, (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "Game.hpp"
+#include <cstdio>
 #include <iostream>
 
 class GameTest : public ::testing::Test {
@@ -432,8 +433,8 @@ TEST_F(GameTest, TemporaryWallCollisionTest) {
 
 // Temporary Wall 만료 테스트
 TEST_F(GameTest, TemporaryWallExpirationIntegrationTest) {
-    // 자동 생성 타이머를 미래로 설정하여 자동 생성 방지
-    game->setLastTemporaryWallCreation(std::chrono::steady_clock::now());
+    // 자동 생성 타이머를 현재 게임 시간으로 설정하여 자동 생성 방지
+    game->setLastTemporaryWallCreation(game->getSimulation().getClock().now());
     
     // 짧은 생존 시간의 Temporary Wall 추가
     Position pos(15, 15);
@@ -442,8 +443,7 @@ TEST_F(GameTest, TemporaryWallExpirationIntegrationTest) {
     
     EXPECT_EQ(game->getTemporaryWallManager().getTemporaryWallCount(), 1);
     
-    // 150ms 대기 후 게임 업데이트
-    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    // 게임 업데이트 한 번으로 게임 시계가 한 틱(200ms) 진행됨
     game->update();
     
     // Temporary Wall이 만료되어 제거되었는지 확인
@@ -484,7 +484,7 @@ TEST_F(GameTest, AutoTemporaryWallCreationTimerTest) {
     EXPECT_EQ(game->getTemporaryWallCreationInterval(), 20000);
     
     // 마지막 생성 시간이 초기화되어 있는지 확인
-    auto now = std::chrono::steady_clock::now();
+    auto now = game->getSimulation().getClock().now();
     auto lastCreation = game->getLastTemporaryWallCreation();
     auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastCreation);
     
@@ -538,7 +538,7 @@ TEST_F(GameTest, PeriodicAutoCreationIntegrationTest) {
     
     // 타이머를 과거로 설정하여 즉시 생성 조건 만족
     game->setLastTemporaryWallCreation(
-        std::chrono::steady_clock::now() - std::chrono::milliseconds(21000)
+        game->getSimulation().getClock().now() - std::chrono::milliseconds(21000)
     );
     
     // 게임 업데이트 (자동 생성 트리거)
@@ -548,7 +548,7 @@ TEST_F(GameTest, PeriodicAutoCreationIntegrationTest) {
     EXPECT_GT(game->getTemporaryWallManager().getTemporaryWallCount(), 0);
     
     // 마지막 생성 시간이 업데이트되었는지 확인
-    auto now = std::chrono::steady_clock::now();
+    auto now = game->getSimulation().getClock().now();
     auto lastCreation = game->getLastTemporaryWallCreation();
     auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastCreation);
     
@@ -560,7 +560,7 @@ TEST_F(GameTest, PeriodicAutoCreationIntegrationTest) {
 TEST_F(GameTest, TemporaryWallMapDisplayTest) {
     // 자동 생성 타이머를 과거로 설정
     game->setLastTemporaryWallCreation(
-        std::chrono::steady_clock::now() - std::chrono::milliseconds(21000)
+        game->getSimulation().getClock().now() - std::chrono::milliseconds(21000)
     );
     
     // 게임 업데이트 (자동 생성 + 맵 업데이트)
@@ -596,24 +596,22 @@ TEST_F(GameTest, SurvivalTimeInitializationTest) {
 
 // 생존시간 진행 테스트
 TEST_F(GameTest, SurvivalTimeProgressTest) {
-    // 게임 시작 시간을 과거로 설정 (3초 전)
-    auto pastTime = std::chrono::steady_clock::now() - std::chrono::seconds(3);
-    game->getScoreManager().setGameStartTime(pastTime);
+    // 게임 시계를 3초 진행
+    GameClock& clock = game->getSimulation().getClock();
+    clock.advance(std::chrono::seconds(3));
+    game->getScoreManager().updateGameTime(clock.now());
     
-    // 생존시간이 3초 정도여야 함 (약간의 오차 허용)
-    int survivalTime = game->getScoreManager().getSurvivalTimeSeconds();
-    EXPECT_GE(survivalTime, 2);  // 최소 2초
-    EXPECT_LE(survivalTime, 4);  // 최대 4초 (오차 고려)
+    // 생존시간은 게임 시계 기준으로 정확히 3초여야 함
+    EXPECT_EQ(game->getScoreManager().getSurvivalTimeSeconds(), 3);
     
     // 포맷된 시간 확인
-    std::string formatted = game->getScoreManager().getFormattedSurvivalTime();
-    EXPECT_TRUE(formatted.find("00:0") == 0);  // 00:0X 형식이어야 함
+    EXPECT_EQ(game->getScoreManager().getFormattedSurvivalTime(), "00:03");
 }
 
 // 스테이지 전환 시 생존시간 유지 테스트
 TEST_F(GameTest, SurvivalTimeStageTransitionTest) {
     // 게임 시작 시간을 과거로 설정
-    auto pastTime = std::chrono::steady_clock::now() - std::chrono::seconds(5);
+    auto pastTime = game->getSimulation().getClock().now() - std::chrono::seconds(5);
     game->getScoreManager().setGameStartTime(pastTime);
     
     // 초기 생존시간 확인
@@ -623,8 +621,86 @@ TEST_F(GameTest, SurvivalTimeStageTransitionTest) {
     // 스테이지별 카운터 리셋 (생존시간은 유지되어야 함)
     game->getScoreManager().resetStageSpecificCounters();
     
-    // 생존시간이 유지되는지 확인 (약간의 시간 경과 허용)
+    // 생존시간이 그대로 유지되는지 확인
     int afterResetSurvivalTime = game->getScoreManager().getSurvivalTimeSeconds();
-    EXPECT_GE(afterResetSurvivalTime, initialSurvivalTime);
-    EXPECT_LE(afterResetSurvivalTime, initialSurvivalTime + 2);  // 최대 2초 차이 허용
-} 
\ No newline at end of file
+    EXPECT_EQ(afterResetSurvivalTime, initialSurvivalTime);
+} 
+// 일시 정지 파일로 저장한 게임을 다른 Game에서 이어서 진행하는지 테스트
+TEST_F(GameTest, SnapshotFileResumeTest) {
+    const char* filename = "game_test_suspend.snks";
+    game->update();
+    game->update();
+    ASSERT_TRUE(game->saveSnapshotToFile(filename));
+
+    Game resumed(31, 31);
+    ASSERT_TRUE(resumed.loadSnapshotFromFile(filename));
+    EXPECT_EQ(resumed.getSimulation().getSeed(), game->getSimulation().getSeed());
+    EXPECT_EQ(resumed.getSnake().getHead(), game->getSnake().getHead());
+
+    game->update();
+    resumed.update();
+    EXPECT_EQ(resumed.getSnake().getHead(), game->getSnake().getHead());
+    EXPECT_EQ(resumed.getScoreManager().getTotalScore(), game->getScoreManager().getTotalScore());
+
+    EXPECT_FALSE(resumed.loadSnapshotFromFile("no_such_snapshot.snks"));
+    std::remove(filename);
+}
+
+// 이미 진행했거나 재개한 게임은 리플레이 기록을 거부하는지 테스트 (리플레이는 시드부터 재생)
+TEST_F(GameTest, RecordReplayOnlyBeforeFirstTickTest) {
+    const char* filename = "game_test_record_resume.snks";
+    game->update();
+    ASSERT_TRUE(game->saveSnapshotToFile(filename));
+    EXPECT_FALSE(game->recordReplayTo("game_test_record.rpl"));
+    EXPECT_EQ(game->getReplay(), nullptr);
+
+    Game resumed(31, 31);
+    ASSERT_TRUE(resumed.loadSnapshotFromFile(filename));
+    EXPECT_FALSE(resumed.recordReplayTo("game_test_record.rpl"));
+    EXPECT_EQ(resumed.getReplay(), nullptr);
+
+    Game fresh(31, 31);
+    EXPECT_TRUE(fresh.recordReplayTo("game_test_record.rpl"));
+    EXPECT_NE(fresh.getReplay(), nullptr);
+    std::remove(filename);
+}
+
+// 오토파일럿 행동이 키 입력 경로(handleInput)로 적용되고 리플레이에 기록되는지 테스트
+TEST_F(GameTest, AutopilotFeedsHandleInputTest) {
+    class TurnUpPolicy : public InputPolicy {
+    public:
+        GameAction chooseAction(const Simulation&) override { return GameAction::TURN_UP; }
+    };
+
+    game->recordReplayTo("game_test_autopilot.rpl");
+    game->stepAutopilot();  // 오토파일럿이 없으면 아무것도 하지 않음
+    EXPECT_FALSE(game->hasAutopilot());
+    EXPECT_TRUE(game->getReplay()->getEvents().empty());
+
+    game->setAutopilot(std::make_unique<TurnUpPolicy>());
+    game->stepAutopilot();
+    EXPECT_EQ(game->getSnake().getDirection(), Direction::UP);
+    ASSERT_EQ(game->getReplay()->getEvents().size(), 1u);
+    EXPECT_EQ(game->getReplay()->getEvents()[0].action, GameAction::TURN_UP);
+
+    EXPECT_EQ(Game::keyToAction(Game::actionToKey(GameAction::TURN_LEFT)), GameAction::TURN_LEFT);
+    EXPECT_EQ(Game::keyToAction(Game::actionToKey(GameAction::PLACE_WALL)), GameAction::PLACE_WALL);
+    EXPECT_EQ(Game::actionToKey(GameAction::NONE), ERR);
+}
+
+// 옆 패널이 맵 뷰포트 오른쪽에 붙고, 터미널보다 큰 맵은 뷰포트가 뱀 머리를 따라가는지 테스트
+TEST_F(GameTest, SidePanelFollowsViewportTest) {
+    // 기본 31x31 맵은 넓은 터미널에 전부 보이고 패널은 35열
+    game->layoutScreen(120, 40);
+    EXPECT_EQ(game->getViewport().getWidth(), 31);
+    EXPECT_EQ(game->getViewport().getHeight(), 31);
+    EXPECT_EQ(game->getSidePanelColumn(), 35);
+
+    Game large(1025, 1025);
+    large.layoutScreen(100, 30);
+    const MapViewport& viewport = large.getViewport();
+    EXPECT_EQ(viewport.getWidth(), 100 - Game::SIDE_PANEL_WIDTH - Game::SIDE_PANEL_GAP);
+    EXPECT_EQ(viewport.getHeight(), 30);
+    EXPECT_EQ(large.getSidePanelColumn(), viewport.getWidth() + Game::SIDE_PANEL_GAP);
+    EXPECT_TRUE(viewport.contains(large.getSnake().getHeadX(), large.getSnake().getHeadY()));
+}
@@ -2,6 +2,7 @@
 #include "GateManager.hpp"
 #include "GameMap.hpp"
 #include "Snake.hpp"
+#include "GameClock.hpp"
 #include <memory>
 
 class GateManagerTest : public ::testing::Test {
@@ -9,7 +10,7 @@ protected:
     void SetUp() override {
         map = std::make_unique<GameMap>(31, 31);
         snake = std::make_unique<Snake>(10, 10);
-        gateManager = std::make_unique<GateManager>(*map);
+        gateManager = std::make_unique<GateManager>(*map, clock);
         
         // 테스트용 벽 설정
         map->setWall(5, 5);
@@ -21,6 +22,7 @@ protected:
         // 테스트 정리
     }
 
+    GameClock clock;
     std::unique_ptr<GameMap> map;
     std::unique_ptr<Snake> snake;
     std::unique_ptr<GateManager> gateManager;
@@ -804,4 +806,25 @@ TEST_F(GateManagerTest, IsSameOuterWallFunctionTest) {
     
     // 내부벽과 외부벽
     EXPECT_FALSE(gateManager->isSameOuterWall(Position(5, 5), Position(1, 0)));   // 내부 vs 외부
-} 
\ No newline at end of file
+} 
+// 순간이동 간선이 Gate 쌍과 함께 생기고 사라지는지 테스트
+TEST_F(GateManagerTest, TeleportEdgesFollowPairLifecycleTest) {
+    EXPECT_TRUE(gateManager->getTeleportEdges().empty());
+    gateManager->generateGates(*snake);
+    ASSERT_EQ(gateManager->getGateCount(), 2);
+
+    const auto& edges = gateManager->getTeleportEdges();
+    EXPECT_GE(edges.size(), 6u);  // Gate마다 진입 직전 칸이 맵 안인 방향 3~4개
+    for (const TeleportEdge& edge : edges) {
+        EXPECT_TRUE(gateManager->hasGateAt(edge.gate.x, edge.gate.y));
+        EXPECT_EQ(std::abs(edge.from.x - edge.gate.x) + std::abs(edge.from.y - edge.gate.y), 1);
+        EXPECT_GE(edge.exitCount, 1);
+        EXPECT_LE(edge.exitCount, 4);
+    }
+
+    // 만료로 Gate가 사라지면 간선도 제거
+    clock.advance(std::chrono::seconds(Gate::GATE_DURATION_SECONDS + 1));
+    gateManager->removeExpiredGates();
+    EXPECT_EQ(gateManager->getGateCount(), 0);
+    EXPECT_TRUE(gateManager->getTeleportEdges().empty());
+}
@@ -1,7 +1,7 @@
 #include <gtest/gtest.h>
 #include "Gate.hpp"
+#include "GameClock.hpp"
 #include <chrono>
-#include <thread>
 
 class GateTest : public ::testing::Test {
 protected:
@@ -67,27 +67,31 @@ TEST_F(GateTest, WallTypeTest) {
 TEST_F(GateTest, GateExpirationTest) {
     Gate gate(1, 1, GateType::ENTRANCE, WallType::OUTER, 1, 1);
     
+    GameClock clock;
+    
     // 새로 생성된 Gate는 만료되지 않아야 함
-    EXPECT_FALSE(gate.isExpired());
+    EXPECT_FALSE(gate.isExpired(clock.now()));
     
-    // 생성 시간 확인
-    auto creationTime = gate.getCreationTime();
-    auto now = std::chrono::steady_clock::now();
-    auto timeDiff = std::chrono::duration_cast<std::chrono::seconds>(now - creationTime).count();
+    // 지속시간 직전까지는 유지됨
+    clock.advance(std::chrono::milliseconds(9999));
+    EXPECT_FALSE(gate.isExpired(clock.now()));
     
-    // 생성 시간이 현재 시간과 거의 같아야 함 (1초 이내)
-    EXPECT_LE(timeDiff, 1);
+    // 지속시간(10초)이 지나면 만료됨
+    clock.advance(std::chrono::milliseconds(1));
+    EXPECT_TRUE(gate.isExpired(clock.now()));
 }
 
 // Gate 생성 시간 테스트
 TEST_F(GateTest, GateCreationTimeTest) {
-    auto beforeCreation = std::chrono::steady_clock::now();
-    Gate gate(5, 5, GateType::ENTRANCE, WallType::OUTER);
-    auto afterCreation = std::chrono::steady_clock::now();
+    GameClock clock;
+    clock.advance(std::chrono::milliseconds(1500));
+    Gate gate(5, 5, GateType::ENTRANCE, WallType::OUTER, 0, 1, clock.now());
+    
+    // 생성 시간은 게임 시계 기준으로 기록됨
+    EXPECT_EQ(gate.getCreationTime(), clock.now());
     
-    auto creationTime = gate.getCreationTime();
-    EXPECT_GE(creationTime, beforeCreation);
-    EXPECT_LE(creationTime, afterCreation);
+    clock.advance(std::chrono::seconds(10));
+    EXPECT_TRUE(gate.isExpired(clock.now()));
 }
 
 // Gate getter 메서드 테스트
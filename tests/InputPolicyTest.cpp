@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "InputPolicy.hpp"
+
+class InputPolicyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        simulation = new Simulation(31, 31, 42);
+    }
+
+    void TearDown() override {
+        delete simulation;
+    }
+
+    Simulation* simulation;
+};
+
+// 안전한 칸 판정 테스트
+TEST_F(InputPolicyTest, SafeCellTest) {
+    EXPECT_TRUE(SafeMovePolicy::isSafeCell(0));
+    EXPECT_TRUE(SafeMovePolicy::isSafeCell(5));
+    EXPECT_TRUE(SafeMovePolicy::isSafeCell(7));
+    EXPECT_FALSE(SafeMovePolicy::isSafeCell(1));
+    EXPECT_FALSE(SafeMovePolicy::isSafeCell(2));
+    EXPECT_FALSE(SafeMovePolicy::isSafeCell(4));
+    EXPECT_FALSE(SafeMovePolicy::isSafeCell(9));
+    EXPECT_FALSE(SafeMovePolicy::isSafeCell(-1));
+}
+
+// 같은 시드면 같은 행동 순서인지 테스트
+TEST_F(InputPolicyTest, RandomTurnDeterminismTest) {
+    RandomTurnPolicy first(7, 50);
+    RandomTurnPolicy second(7, 50);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(first.chooseAction(*simulation), second.chooseAction(*simulation));
+    }
+}
+
+// 앞이 벽이면 안전한 방향으로 꺾는지 테스트
+TEST_F(InputPolicyTest, SafeMoveAvoidsWallTest) {
+    SafeMovePolicy policy(1, 0);
+    Position head = simulation->getSnake().getHead();
+    simulation->getMap().setCellValue(head.x + 1, head.y, 1);
+
+    GameAction action = policy.chooseAction(*simulation);
+    EXPECT_TRUE(action == GameAction::TURN_UP || action == GameAction::TURN_DOWN);
+}
+
+// 안전 정책이 무작위 정책보다 오래 살아남는지 테스트
+TEST_F(InputPolicyTest, SafeMoveSurvivesTest) {
+    SafeMovePolicy policy(3);
+    for (int tick = 0; tick < 100 && !simulation->isGameOver(); tick++) {
+        simulation->applyAction(policy.chooseAction(*simulation));
+        simulation->update();
+    }
+    EXPECT_GE(simulation->getClock().getTickCount(), 50);
+}
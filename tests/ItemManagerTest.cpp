@@ -2,22 +2,23 @@
 #include "ItemManager.hpp"
 #include "GameMap.hpp"
 #include "Snake.hpp"
+#include "GameClock.hpp"
 #include <memory>
 #include <chrono>
-#include <thread>
 
 class ItemManagerTest : public ::testing::Test {
 protected:
     void SetUp() override {
         gameMap = std::make_unique<GameMap>(31, 31);  // 기본 맵 크기
         snake = std::make_unique<Snake>(10, 10);
-        itemManager = std::make_unique<ItemManager>(*gameMap);
+        itemManager = std::make_unique<ItemManager>(*gameMap, clock);
     }
 
     void TearDown() override {
         // 테스트 정리
     }
 
+    GameClock clock;
     std::unique_ptr<GameMap> gameMap;
     std::unique_ptr<Snake> snake;
     std::unique_ptr<ItemManager> itemManager;
@@ -56,8 +57,8 @@ TEST_F(ItemManagerTest, ItemExpirationTest) {
     itemManager->addItem(5, 5, ItemType::GROWTH, std::chrono::milliseconds(50));
     EXPECT_EQ(itemManager->getItemCount(), 1);
     
-    // 만료 시간 대기
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // 만료 시간 경과
+    clock.advance(std::chrono::milliseconds(100));
     
     // 만료된 아이템 제거
     itemManager->removeExpiredItems();
@@ -176,4 +177,23 @@ TEST_F(ItemManagerTest, RandomItemTypeIncludesSpeedTest) {
         }
     }
     EXPECT_TRUE(speedFound);
-} 
\ No newline at end of file
+} 
+// 거의 가득 찬 맵에서도 남은 빈 칸을 찾는지 테스트
+TEST_F(ItemManagerTest, FindEmptyPositionOnCrowdedMapTest) {
+    // 내부를 모두 벽으로 채우고 한 칸만 남김
+    for (int y = 1; y < gameMap->getHeight() - 1; y++) {
+        for (int x = 1; x < gameMap->getWidth() - 1; x++) {
+            gameMap->setWall(x, y);
+        }
+    }
+    gameMap->setCellValue(3, 27, 0);
+
+    auto emptyPos = itemManager->findEmptyPosition(*snake);
+    ASSERT_TRUE(emptyPos.has_value());
+    EXPECT_EQ(emptyPos->x, 3);
+    EXPECT_EQ(emptyPos->y, 27);
+
+    // 빈 칸이 하나도 없으면 찾지 못함
+    gameMap->setWall(3, 27);
+    EXPECT_FALSE(itemManager->findEmptyPosition(*snake).has_value());
+}
@@ -1,8 +1,8 @@
 #include <gtest/gtest.h>
 #include "Item.hpp"
 #include "Snake.hpp"  // Position 구조체를 위해 필요
+#include "GameClock.hpp"
 #include <chrono>
-#include <thread>
 
 class ItemTest : public ::testing::Test {
 protected:
@@ -39,26 +39,30 @@ TEST_F(ItemTest, ItemPositionTest) {
 // Item 만료 시간 테스트
 TEST_F(ItemTest, ItemExpirationTest) {
     Item item(5, 5, ItemType::GROWTH);
+    GameClock clock;
     
     // 생성 직후에는 만료되지 않음
-    EXPECT_FALSE(item.isExpired());
+    EXPECT_FALSE(item.isExpired(clock.now()));
     
-    // 짧은 시간 대기 후에도 만료되지 않음
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    EXPECT_FALSE(item.isExpired());
+    // 짧은 시간 경과 후에도 만료되지 않음
+    clock.advance(std::chrono::milliseconds(100));
+    EXPECT_FALSE(item.isExpired(clock.now()));
+    EXPECT_EQ(item.getRemainingTime(clock.now()), std::chrono::milliseconds(4900));
 }
 
 // Item 만료 시간 설정 테스트
 TEST_F(ItemTest, ItemCustomExpirationTest) {
     // 매우 짧은 만료 시간으로 아이템 생성 (테스트용)
     Item item(5, 5, ItemType::GROWTH, std::chrono::milliseconds(50));
+    GameClock clock;
     
     // 생성 직후에는 만료되지 않음
-    EXPECT_FALSE(item.isExpired());
+    EXPECT_FALSE(item.isExpired(clock.now()));
     
-    // 만료 시간보다 긴 시간 대기
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    EXPECT_TRUE(item.isExpired());
+    // 만료 시간보다 긴 시간 경과
+    clock.advance(std::chrono::milliseconds(100));
+    EXPECT_TRUE(item.isExpired(clock.now()));
+    EXPECT_EQ(item.getRemainingTime(clock.now()), std::chrono::milliseconds(0));
 }
 
 // Item 타입별 테스트
@@ -93,18 +97,19 @@ TEST_F(ItemTest, SpeedItemBasicProperties) {
     EXPECT_EQ(speedItem.getType(), ItemType::SPEED);
     
     // 만료되지 않았는지 확인 (기본 5초 지속시간)
-    EXPECT_FALSE(speedItem.isExpired());
+    EXPECT_FALSE(speedItem.isExpired(GameClock::time_point()));
 }
 
 // SPEED 아이템의 만료 시간 테스트
 TEST_F(ItemTest, SpeedItemExpiration) {
     // 매우 짧은 지속시간으로 SPEED 아이템 생성
     Item speedItem(1, 1, ItemType::SPEED, std::chrono::milliseconds(1));
+    GameClock clock;
     
     // 초기에는 만료되지 않음
-    EXPECT_FALSE(speedItem.isExpired());
+    EXPECT_FALSE(speedItem.isExpired(clock.now()));
     
-    // 잠시 대기 후 만료 확인
-    std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    EXPECT_TRUE(speedItem.isExpired());
+    // 한 틱 경과 후 만료 확인
+    clock.advance(std::chrono::milliseconds(10));
+    EXPECT_TRUE(speedItem.isExpired(clock.now()));
 } 
\ No newline at end of file
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "LatencyHistogram.hpp"
+
+class LatencyHistogramTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        histogram = new LatencyHistogram();
+    }
+
+    void TearDown() override {
+        delete histogram;
+    }
+
+    LatencyHistogram* histogram;
+};
+
+// 초기 상태 테스트
+TEST_F(LatencyHistogramTest, InitializationTest) {
+    EXPECT_EQ(histogram->getCount(), 0u);
+    EXPECT_EQ(histogram->getMin(), 0u);
+    EXPECT_EQ(histogram->getMax(), 0u);
+    EXPECT_EQ(histogram->percentile(0.5), 0u);
+}
+
+// 구간 경계가 연속이고 값이 올바른 구간에 들어가는지 테스트
+TEST_F(LatencyHistogramTest, BucketLayoutTest) {
+    for (int i = 0; i + 1 < LatencyHistogram::BUCKET_COUNT; i++) {
+        EXPECT_EQ(LatencyHistogram::bucketLowerBound(i) + LatencyHistogram::bucketWidth(i),
+                  LatencyHistogram::bucketLowerBound(i + 1));
+    }
+
+    const uint64_t values[] = {0, 1, 15, 16, 17, 31, 32, 1000, 123456789, UINT64_MAX};
+    for (uint64_t value : values) {
+        int index = LatencyHistogram::bucketIndex(value);
+        ASSERT_GE(index, 0);
+        ASSERT_LT(index, LatencyHistogram::BUCKET_COUNT);
+        EXPECT_GE(value, LatencyHistogram::bucketLowerBound(index));
+        EXPECT_LE(value - LatencyHistogram::bucketLowerBound(index),
+                  LatencyHistogram::bucketWidth(index) - 1);
+    }
+}
+
+// 백분위수가 상대 오차 범위 안에 있는지 테스트
+TEST_F(LatencyHistogramTest, PercentileTest) {
+    for (uint64_t value = 1; value <= 10000; value++) {
+        histogram->record(value * 1000);
+    }
+
+    EXPECT_EQ(histogram->getCount(), 10000u);
+    EXPECT_EQ(histogram->getMin(), 1000u);
+    EXPECT_EQ(histogram->getMax(), 10000000u);
+    EXPECT_NEAR(histogram->getMean(), 5000500.0, 1.0);
+
+    EXPECT_NEAR(static_cast<double>(histogram->percentile(0.5)), 5000000.0, 5000000.0 * 0.0625);
+    EXPECT_NEAR(static_cast<double>(histogram->percentile(0.99)), 9900000.0, 9900000.0 * 0.0625);
+    EXPECT_NEAR(static_cast<double>(histogram->percentile(0.999)), 9990000.0, 9990000.0 * 0.0625);
+    EXPECT_LE(histogram->percentile(1.0), histogram->getMax());
+}
+
+// 작은 값은 정확히 기록되는지 테스트
+TEST_F(LatencyHistogramTest, ExactSmallValuesTest) {
+    histogram->record(3);
+    histogram->record(3);
+    histogram->record(7);
+
+    EXPECT_EQ(histogram->percentile(0.5), 3u);
+    EXPECT_EQ(histogram->percentile(1.0), 7u);
+}
+
+// 합치기와 초기화 테스트
+TEST_F(LatencyHistogramTest, MergeAndResetTest) {
+    LatencyHistogram other;
+    histogram->record(100);
+    other.record(50);
+    other.record(5000);
+
+    histogram->merge(other);
+    EXPECT_EQ(histogram->getCount(), 3u);
+    EXPECT_EQ(histogram->getMin(), 50u);
+    EXPECT_EQ(histogram->getMax(), 5000u);
+
+    histogram->reset();
+    EXPECT_EQ(histogram->getCount(), 0u);
+    EXPECT_EQ(histogram->getMax(), 0u);
+}
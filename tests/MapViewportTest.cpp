@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "MapViewport.hpp"
+
+class MapViewportTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        viewport.setScreenSize(40, 20);
+    }
+
+    MapViewport viewport;
+};
+
+// 화면 크기 제한이 없으면 맵 전체를 보여주는지 테스트
+TEST_F(MapViewportTest, UnlimitedScreenShowsWholeMapTest) {
+    MapViewport unlimited;
+    unlimited.follow(31, 31, 15, 15);
+    EXPECT_EQ(unlimited.getX(), 0);
+    EXPECT_EQ(unlimited.getY(), 0);
+    EXPECT_EQ(unlimited.getWidth(), 31);
+    EXPECT_EQ(unlimited.getHeight(), 31);
+}
+
+// 화면보다 작은 축은 맵 크기 그대로, 카메라는 0에 고정되는지 테스트
+TEST_F(MapViewportTest, SmallMapFitsScreenTest) {
+    viewport.follow(31, 31, 29, 29);
+    EXPECT_EQ(viewport.getX(), 0);
+    EXPECT_EQ(viewport.getWidth(), 31);
+    // 세로는 화면(20줄)보다 크므로 따라감
+    EXPECT_EQ(viewport.getHeight(), 20);
+    EXPECT_EQ(viewport.getY(), 11);
+    EXPECT_TRUE(viewport.contains(29, 29));
+}
+
+// 여백 안쪽에서는 카메라가 움직이지 않고, 가장자리 여백에 들어오면 가운데로 옮기는지 테스트
+TEST_F(MapViewportTest, FollowsFocusWithEdgeMarginTest) {
+    viewport.follow(4096, 4096, 2000, 1000);
+    EXPECT_EQ(viewport.getX(), 2000 - 20);
+    EXPECT_EQ(viewport.getY(), 1000 - 10);
+
+    // 여백 안쪽 이동은 카메라 유지
+    int lastInside = viewport.getX() + viewport.getWidth() - 1 - MapViewport::EDGE_MARGIN;
+    viewport.follow(4096, 4096, lastInside, 1000);
+    EXPECT_EQ(viewport.getX(), 2000 - 20);
+
+    // 여백에 들어오면 다시 가운데로
+    viewport.follow(4096, 4096, lastInside + 1, 1000);
+    EXPECT_EQ(viewport.getX(), lastInside + 1 - 20);
+    EXPECT_TRUE(viewport.contains(lastInside + 1, 1000));
+}
+
+// 카메라가 맵 밖으로 나가지 않는지 테스트
+TEST_F(MapViewportTest, ClampsToMapBoundsTest) {
+    viewport.follow(4096, 4096, 1, 1);
+    EXPECT_EQ(viewport.getX(), 0);
+    EXPECT_EQ(viewport.getY(), 0);
+
+    viewport.follow(4096, 4096, 4094, 4094);
+    EXPECT_EQ(viewport.getX(), 4096 - 40);
+    EXPECT_EQ(viewport.getY(), 4096 - 20);
+    EXPECT_TRUE(viewport.contains(4095, 4095));
+}
+
+// 뷰포트 밖으로 순간이동해도 따라갈 칸이 보이는지 테스트 (Gate 통과)
+TEST_F(MapViewportTest, JumpKeepsFocusVisibleTest) {
+    viewport.follow(1000, 1000, 10, 10);
+    for (int focus : {990, 500, 3, 700}) {
+        viewport.follow(1000, 1000, focus, 1000 - focus);
+        EXPECT_TRUE(viewport.contains(focus, 1000 - focus)) << focus;
+    }
+}
+
+// 화면이 아주 작아도 따라갈 칸이 보이는지 테스트
+TEST_F(MapViewportTest, TinyScreenTest) {
+    viewport.setScreenSize(3, 1);
+    for (int x = 1; x < 50; x++) {
+        viewport.follow(50, 50, x, 25);
+        EXPECT_TRUE(viewport.contains(x, 25)) << x;
+        EXPECT_EQ(viewport.getWidth(), 3);
+        EXPECT_EQ(viewport.getHeight(), 1);
+    }
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "NavigationGraph.hpp"
+
+class NavigationGraphTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        simulation = new Simulation(31, 31, 42);
+    }
+
+    void TearDown() override {
+        delete simulation;
+    }
+
+    int indexOf(int x, int y) const { return y * simulation->getMap().getWidth() + x; }
+
+    Simulation* simulation;
+};
+
+// 격자 이동: 빈 칸은 도착, 벽/몸통/맵 밖은 -1인지 테스트
+TEST_F(NavigationGraphTest, GridStepTest) {
+    NavigationGraph graph(*simulation);
+    Position head = simulation->getSnake().getHead();
+    int start = indexOf(head.x, head.y);
+
+    EXPECT_EQ(graph.step(start, static_cast<int>(Direction::UP)), indexOf(head.x, head.y - 1));
+    EXPECT_EQ(graph.step(start, static_cast<int>(Direction::RIGHT)), indexOf(head.x + 1, head.y));
+    EXPECT_EQ(graph.step(start, static_cast<int>(Direction::LEFT)), -1);  // 몸통
+    EXPECT_EQ(graph.step(indexOf(1, 1), static_cast<int>(Direction::UP)), -1);  // 테두리 벽
+    EXPECT_EQ(graph.step(indexOf(0, 0), static_cast<int>(Direction::LEFT)), -1);  // 맵 밖
+    EXPECT_TRUE(graph.getTeleports().empty());
+}
+
+// 순간이동 간선의 도착 칸이 실제 게임에서 Gate를 지난 뒤 머리 위치와 같은지 테스트
+// (외곽 벽 Gate: 1 스테이지, 내부 벽 Gate: 2 스테이지 Cross, 4 스테이지 Box)
+TEST_F(NavigationGraphTest, TeleportMatchesSimulationTest) {
+    int checked = 0;
+    int innerChecked = 0;
+    for (int stage : {1, 2, 4}) {
+        for (uint64_t seed = 1; seed <= 40; seed++) {
+            Simulation base(31, 31, seed);
+            for (int next = 1; next < stage; next++) {
+                base.getStageManager().nextStage();
+            }
+            base.getStageManager().applyCurrentStageToMap(base.getMap());
+            base.getGateManager().generateGates(base.getSnake());
+            const GameMap& map = base.getMap();
+
+            for (const TeleportEdge& edge : base.getGateManager().getTeleportEdges()) {
+                if (map.getCellValue(edge.from.x, edge.from.y) != 0) continue;
+
+                // 머리를 진입 직전 칸에 두고 진입 방향을 봄 (반대 방향은 한 번 꺾어서 설정)
+                auto child = base.fork();
+                child->getSnake().teleportTo(edge.from);
+                child->getSnake().setDirection(edge.entryDirection == Direction::LEFT ? Direction::UP
+                                                                                       : edge.entryDirection);
+                child->getSnake().setDirection(edge.entryDirection);
+                ASSERT_EQ(child->getSnake().getDirection(), edge.entryDirection);
+
+                NavigationGraph graph(*child);
+                int predicted = graph.step(indexOf(edge.from.x, edge.from.y),
+                                           static_cast<int>(edge.entryDirection));
+                if (predicted < 0) continue;  // 출구가 모두 막힌 간선
+                ASSERT_GE(graph.getTeleports().size(), 1u);
+
+                child->update();
+                Position head = child->getSnake().getHead();
+                EXPECT_EQ(indexOf(head.x, head.y), predicted)
+                    << "stage " << stage << " seed " << seed << " gate (" << edge.gate.x << ", " << edge.gate.y << ")";
+                EXPECT_EQ(child->getScoreManager().getGatesUsed(), 1);
+                checked++;
+                innerChecked += map.getWallSide(edge.gate.x, edge.gate.y) == WallSide::INNER ? 1 : 0;
+            }
+        }
+    }
+    EXPECT_GT(checked, 40);
+    EXPECT_GT(innerChecked, 0);
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "ObservationEncoder.hpp"
+#include "Simulation.hpp"
+#include <vector>
+
+class ObservationEncoderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        map = new GameMap(21, 21);
+        buffer.assign(ObservationEncoder::getBufferSize(21, 21), 0xFF);
+        encoder = new ObservationEncoder(*map, buffer.data());
+    }
+
+    void TearDown() override {
+        delete encoder;
+        delete map;
+    }
+
+    // 평면 값이 맵 셀 값과 정확히 대응하는지 확인
+    static void expectPlanesMatch(const GameMap& map, const uint8_t* planes) {
+        size_t planeSize = static_cast<size_t>(map.getWidth()) * map.getHeight();
+        for (int y = 0; y < map.getHeight(); y++) {
+            for (int x = 0; x < map.getWidth(); x++) {
+                int expectedPlane = ObservationEncoder::planeForCell(map.getCellValue(x, y));
+                for (int plane = 0; plane < ObservationEncoder::PLANE_COUNT; plane++) {
+                    ASSERT_EQ(planes[plane * planeSize + y * map.getWidth() + x], plane == expectedPlane ? 1 : 0)
+                        << "plane " << plane << " at (" << x << ", " << y << ")";
+                }
+            }
+        }
+    }
+
+    GameMap* map;
+    std::vector<uint8_t> buffer;
+    ObservationEncoder* encoder;
+};
+
+// 셀 값과 평면 대응 테스트
+TEST_F(ObservationEncoderTest, PlaneMappingTest) {
+    EXPECT_EQ(ObservationEncoder::planeForCell(0), -1);
+    EXPECT_EQ(ObservationEncoder::planeForCell(1), static_cast<int>(ObservationPlane::WALL));
+    EXPECT_EQ(ObservationEncoder::planeForCell(2), static_cast<int>(ObservationPlane::IMMUNE_WALL));
+    EXPECT_EQ(ObservationEncoder::planeForCell(3), static_cast<int>(ObservationPlane::HEAD));
+    EXPECT_EQ(ObservationEncoder::planeForCell(7), static_cast<int>(ObservationPlane::GATE));
+    EXPECT_EQ(ObservationEncoder::planeForCell(8), static_cast<int>(ObservationPlane::SPEED));
+    EXPECT_EQ(ObservationEncoder::planeForCell(9), static_cast<int>(ObservationPlane::TEMPORARY_WALL));
+}
+
+// 첫 동기화는 전체 인코딩 테스트
+TEST_F(ObservationEncoderTest, InitialFullEncodeTest) {
+    map->setWall(5, 5);
+    map->setSnakeHead(10, 10);
+    encoder->sync();
+
+    EXPECT_TRUE(encoder->wasLastSyncFull());
+    expectPlanesMatch(*map, buffer.data());
+    EXPECT_EQ(encoder->getPlane(ObservationPlane::HEAD)[10 * 21 + 10], 1);
+}
+
+// 변경 셀만 증분 반영 테스트
+TEST_F(ObservationEncoderTest, IncrementalSyncTest) {
+    encoder->sync();
+
+    map->setSnakeHead(3, 3);
+    map->setSnakeBody(4, 3);
+    map->setCellValue(6, 6, 5);
+    map->setCellValue(6, 6, 8);  // 같은 셀이 여러 번 바뀌어도 마지막 값
+    map->setCellValue(0, 0, 7);  // 벽이 Gate로
+    encoder->sync();
+
+    EXPECT_FALSE(encoder->wasLastSyncFull());
+    expectPlanesMatch(*map, buffer.data());
+
+    map->setCellValue(3, 3, 0);
+    encoder->sync();
+    EXPECT_FALSE(encoder->wasLastSyncFull());
+    EXPECT_EQ(encoder->getPlane(ObservationPlane::HEAD)[3 * 21 + 3], 0);
+    expectPlanesMatch(*map, buffer.data());
+}
+
+// 변경 기록이 밀려나면 전체 인코딩으로 복구 테스트
+TEST_F(ObservationEncoderTest, JournalOverflowFallsBackToFullTest) {
+    encoder->sync();
+    for (int round = 0; round < 10; round++) {
+        for (int y = 1; y < 20; y++) {
+            for (int x = 1; x < 20; x++) {
+                map->setCellValue(x, y, (x + y + round) % 3 == 0 ? 9 : 0);
+            }
+        }
+    }
+    encoder->sync();
+    EXPECT_TRUE(encoder->wasLastSyncFull());
+    expectPlanesMatch(*map, buffer.data());
+}
+
+// 게임 진행 중 증분 결과가 맵과 일치하는지 테스트
+TEST_F(ObservationEncoderTest, SimulationIncrementalTest) {
+    Simulation simulation(31, 31, 11);
+    std::vector<uint8_t> planes(ObservationEncoder::getBufferSize(31, 31));
+    ObservationEncoder simulationEncoder(simulation.getMap(), planes.data());
+    simulationEncoder.sync();
+
+    const GameAction turns[] = {
+        GameAction::TURN_UP, GameAction::TURN_LEFT, GameAction::TURN_DOWN, GameAction::TURN_RIGHT
+    };
+    for (int tick = 0; tick < 80 && !simulation.isGameOver(); tick++) {
+        if (tick % 4 == 0) {
+            simulation.applyAction(turns[(tick / 4) % 4]);
+        }
+        simulation.update();
+        simulationEncoder.sync();
+        expectPlanesMatch(simulation.getMap(), planes.data());
+    }
+}
+
+// 자기중심 잘라내기 테스트
+TEST_F(ObservationEncoderTest, EgocentricCropTest) {
+    map->setSnakeHead(1, 1);
+    map->setCellValue(2, 1, 5);
+
+    const int radius = 2;
+    const int side = 2 * radius + 1;
+    std::vector<uint8_t> crop(ObservationEncoder::getCropBufferSize(radius));
+    ObservationEncoder::encodeCrop(*map, Position(1, 1), radius, crop.data());
+
+    size_t planeSize = side * side;
+    auto at = [&](ObservationPlane plane, int dx, int dy) {
+        return crop[static_cast<int>(plane) * planeSize + (dy + radius) * side + (dx + radius)];
+    };
+
+    EXPECT_EQ(at(ObservationPlane::HEAD, 0, 0), 1);
+    EXPECT_EQ(at(ObservationPlane::GROWTH, 1, 0), 1);
+    EXPECT_EQ(at(ObservationPlane::IMMUNE_WALL, -1, 0), 1);  // 테두리
+    EXPECT_EQ(at(ObservationPlane::IMMUNE_WALL, -2, -2), 1); // 맵 밖
+    EXPECT_EQ(at(ObservationPlane::WALL, 1, 1), 0);
+    EXPECT_EQ(at(ObservationPlane::IMMUNE_WALL, 1, 1), 0);   // 빈 칸
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include "ReplayPlayer.hpp"
+#include "InputPolicy.hpp"
+
+class ReplayPlayerTest : public ::testing::Test {
+protected:
+    // 정책으로 게임을 진행하며 리플레이 기록 (Game::handleInput과 같은 방식)
+    static Replay recordGame(uint64_t seed, int maxTicks) {
+        Simulation simulation(31, 31, seed);
+        Replay replay(31, 31, seed);
+        SafeMovePolicy policy(seed);
+
+        for (int tick = 0; tick < maxTicks && !simulation.isGameOver(); tick++) {
+            GameAction action = policy.chooseAction(simulation);
+            if (tick % 97 == 50) {
+                action = GameAction::PLACE_WALL;  // 't' 키
+            }
+            replay.recordAction(simulation.getClock().getTickCount(), action);
+            simulation.applyAction(action);
+            simulation.update();
+        }
+        replay.finish(simulation);
+        return replay;
+    }
+};
+
+// 재생 결과가 기록과 정확히 같은지 테스트
+TEST_F(ReplayPlayerTest, ReproducesScoreTotalsTest) {
+    for (uint64_t seed = 1; seed <= 10; seed++) {
+        Replay replay = recordGame(seed, 3000);
+
+        // 직렬화를 거친 뒤 재생
+        Replay decoded;
+        ASSERT_TRUE(decoded.decode(replay.encode()));
+        ReplayResult result = ReplayPlayer::play(decoded);
+
+        EXPECT_TRUE(result.matchesRecording) << "seed " << seed;
+        EXPECT_EQ(result.ticks, replay.getTickCount());
+        EXPECT_EQ(result.totals.score, replay.getTotals().score);
+    }
+}
+
+// 한 틱씩 재생 테스트
+TEST_F(ReplayPlayerTest, StepTest) {
+    Replay replay = recordGame(3, 20);
+    ReplayPlayer player(replay);
+
+    int steps = 0;
+    while (player.step()) {
+        steps++;
+    }
+    EXPECT_EQ(steps, replay.getTickCount());
+    EXPECT_TRUE(player.isFinished());
+}
+
+// 종료 키까지 재생 테스트
+TEST_F(ReplayPlayerTest, QuitEventTest) {
+    Simulation simulation(31, 31, 9);
+    Replay replay(31, 31, 9);
+    for (int tick = 0; tick < 5; tick++) {
+        simulation.update();
+    }
+    replay.recordAction(simulation.getClock().getTickCount(), GameAction::QUIT);
+    simulation.applyAction(GameAction::QUIT);
+    replay.finish(simulation);
+
+    ReplayResult result = ReplayPlayer::play(replay);
+    EXPECT_TRUE(result.matchesRecording);
+    EXPECT_EQ(result.ticks, 5);
+}
+
+// 기록과 다른 결과를 감지하는지 테스트
+TEST_F(ReplayPlayerTest, DetectsMismatchTest) {
+    Replay replay = recordGame(4, 3000);
+
+    // 시드 바이트를 바꿔 같은 입력을 다른 게임에 재생 (헤더: 매직 4 + 버전 1 + 너비 1 + 높이 1)
+    std::vector<uint8_t> bytes = replay.encode();
+    bytes[7] ^= 0x5A;
+    Replay tampered;
+    ASSERT_TRUE(tampered.decode(bytes));
+    ASSERT_NE(tampered.getSeed(), replay.getSeed());
+
+    EXPECT_FALSE(ReplayPlayer::play(tampered).matchesRecording);
+}
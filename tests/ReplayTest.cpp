@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "Replay.hpp"
+#include <cstdio>
+
+class ReplayTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        replay = new Replay(31, 31, 0x0123456789ABCDEFULL);
+    }
+
+    void TearDown() override {
+        delete replay;
+    }
+
+    Replay* replay;
+};
+
+// 초기화 테스트
+TEST_F(ReplayTest, InitializationTest) {
+    EXPECT_EQ(replay->getWidth(), 31);
+    EXPECT_EQ(replay->getHeight(), 31);
+    EXPECT_EQ(replay->getSeed(), 0x0123456789ABCDEFULL);
+    EXPECT_TRUE(replay->getEvents().empty());
+}
+
+// NONE 행동은 기록하지 않는지 테스트
+TEST_F(ReplayTest, IgnoreNoneActionTest) {
+    replay->recordAction(3, GameAction::NONE);
+    replay->recordAction(3, GameAction::TURN_UP);
+    ASSERT_EQ(replay->getEvents().size(), 1u);
+    EXPECT_EQ(replay->getEvents()[0].action, GameAction::TURN_UP);
+}
+
+// 인코딩 후 디코딩하면 같은 내용인지 테스트
+TEST_F(ReplayTest, EncodeDecodeRoundTripTest) {
+    Simulation simulation(31, 31, 5);
+    replay->recordAction(0, GameAction::TURN_UP);
+    replay->recordAction(0, GameAction::TURN_LEFT);  // 같은 틱에 여러 입력
+    replay->recordAction(200, GameAction::PLACE_WALL);
+    replay->recordAction(5000, GameAction::QUIT);
+    replay->finish(simulation);
+
+    Replay decoded;
+    ASSERT_TRUE(decoded.decode(replay->encode()));
+    EXPECT_EQ(decoded.getWidth(), 31);
+    EXPECT_EQ(decoded.getSeed(), replay->getSeed());
+    EXPECT_EQ(decoded.getTickCount(), replay->getTickCount());
+    EXPECT_EQ(decoded.getTotals(), replay->getTotals());
+    ASSERT_EQ(decoded.getEvents().size(), 4u);
+    EXPECT_EQ(decoded.getEvents()[1].tick, 0);
+    EXPECT_EQ(decoded.getEvents()[1].action, GameAction::TURN_LEFT);
+    EXPECT_EQ(decoded.getEvents()[3].tick, 5000);
+    EXPECT_EQ(decoded.getEvents()[3].action, GameAction::QUIT);
+}
+
+// 입력이 드문 1분 게임의 크기 테스트
+TEST_F(ReplayTest, CompactSizeTest) {
+    // 200ms 틱으로 1분 = 300틱, 2초마다 방향 전환
+    for (int tick = 0; tick < 300; tick += 10) {
+        replay->recordAction(tick, tick % 20 == 0 ? GameAction::TURN_UP : GameAction::TURN_RIGHT);
+    }
+    EXPECT_LT(replay->encode().size(), 64u);
+}
+
+// 잘못된 데이터 거부 테스트
+TEST_F(ReplayTest, RejectCorruptDataTest) {
+    Replay decoded;
+    EXPECT_FALSE(decoded.decode({}));
+    EXPECT_FALSE(decoded.decode({'X', 'X', 'X', 'X', 1, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0}));
+
+    std::vector<uint8_t> bytes = replay->encode();
+    bytes.resize(bytes.size() - 3);  // 잘린 파일
+    EXPECT_FALSE(decoded.decode(bytes));
+
+    // 게임이 만들 수 없는 맵 크기 (머리: 매직 4 + 버전 1, 이어서 너비/높이 varint 각 1바이트)
+    std::vector<uint8_t> valid = replay->encode();
+    auto withSize = [&valid](uint64_t width, uint64_t height) {
+        std::vector<uint8_t> sized(valid.begin(), valid.begin() + 5);
+        StateWriter writer(sized);
+        writer.writeVarint(width);
+        writer.writeVarint(height);
+        sized.insert(sized.end(), valid.begin() + 7, valid.end());
+        return sized;
+    };
+    ASSERT_TRUE(decoded.decode(withSize(31, 31)));
+    for (uint64_t size : {0ULL, 20ULL, 8193ULL, 3000000000ULL, 1ULL << 32}) {
+        EXPECT_FALSE(decoded.decode(withSize(size, 31))) << size;
+        EXPECT_FALSE(decoded.decode(withSize(31, size))) << size;
+    }
+    EXPECT_TRUE(decoded.decode(withSize(GameMap::MIN_SIZE, GameMap::MAX_SIZE)));
+    EXPECT_EQ(decoded.getWidth(), GameMap::MIN_SIZE);
+    EXPECT_EQ(decoded.getHeight(), GameMap::MAX_SIZE);
+}
+
+// 파일 입출력 테스트
+TEST_F(ReplayTest, FileIOTest) {
+    const std::string filename = "replay_test.snkr";
+    replay->recordAction(7, GameAction::TURN_DOWN);
+    ASSERT_TRUE(replay->saveToFile(filename));
+
+    Replay loaded;
+    ASSERT_TRUE(loaded.loadFromFile(filename));
+    ASSERT_EQ(loaded.getEvents().size(), 1u);
+    EXPECT_EQ(loaded.getEvents()[0].tick, 7);
+    std::remove(filename.c_str());
+
+    EXPECT_FALSE(loaded.loadFromFile("missing_replay.snkr"));
+}
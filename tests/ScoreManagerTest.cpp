@@ -3,7 +3,6 @@
 #include <fstream>
 #include <filesystem>
 #include <chrono>
-#include <thread>
 
 class ScoreManagerTest : public ::testing::Test {
 protected:
@@ -206,33 +205,29 @@ TEST_F(ScoreManagerTest, SurvivalTimeSetupTest) {
 
 // 생존시간 계산 테스트
 TEST_F(ScoreManagerTest, SurvivalTimeCalculationTest) {
-    // 게임 시작 시간을 과거로 설정 (2초 전)
-    auto pastTime = std::chrono::steady_clock::now() - std::chrono::seconds(2);
-    scoreManager->setGameStartTime(pastTime);
-    
-    // 생존시간이 2초 정도여야 함 (약간의 오차 허용)
-    int survivalTime = scoreManager->getSurvivalTimeSeconds();
-    EXPECT_GE(survivalTime, 1);  // 최소 1초
-    EXPECT_LE(survivalTime, 3);  // 최대 3초 (오차 고려)
+    // 게임 시작 후 2초가 지난 시점
+    scoreManager->setGameStartTime(GameClock::time_point());
+    scoreManager->updateGameTime(GameClock::time_point(std::chrono::seconds(2)));
+    
+    // 게임 시계 기준이므로 정확히 2초여야 함
+    EXPECT_EQ(scoreManager->getSurvivalTimeSeconds(), 2);
 }
 
 // 생존시간 포맷팅 테스트
 TEST_F(ScoreManagerTest, SurvivalTimeFormattingTest) {
-    // 65초 전으로 설정 (1분 5초)
-    auto pastTime = std::chrono::steady_clock::now() - std::chrono::seconds(65);
-    scoreManager->setGameStartTime(pastTime);
-    
-    std::string formatted = scoreManager->getFormattedSurvivalTime();
+    // 게임 시작 후 65초 경과 (1분 5초)
+    scoreManager->setGameStartTime(GameClock::time_point());
+    scoreManager->updateGameTime(GameClock::time_point(std::chrono::seconds(65)));
     
-    // 01:05 형식이어야 함 (약간의 오차 허용)
-    EXPECT_TRUE(formatted.find("01:0") == 0);  // 1분대여야 함
+    // 01:05 형식이어야 함
+    EXPECT_EQ(scoreManager->getFormattedSurvivalTime(), "01:05");
 }
 
 // 생존시간 리셋 테스트
 TEST_F(ScoreManagerTest, SurvivalTimeResetTest) {
-    // 시작 시간 설정 후 잠시 대기 (1초로 증가)
+    // 시작 시간 설정 후 1.1초 경과
     scoreManager->setGameStartTime();
-    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    scoreManager->updateGameTime(GameClock::time_point(std::chrono::milliseconds(1100)));
     
     // 생존시간이 0보다 커야 함
     EXPECT_GT(scoreManager->getSurvivalTimeSeconds(), 0);
@@ -246,9 +241,9 @@ TEST_F(ScoreManagerTest, SurvivalTimeResetTest) {
 
 // 생존시간 파일 저장/로드 테스트
 TEST_F(ScoreManagerTest, SurvivalTimeFileIOTest) {
-    // 시작 시간을 과거로 설정
-    auto pastTime = std::chrono::steady_clock::now() - std::chrono::seconds(30);
-    scoreManager->setGameStartTime(pastTime);
+    // 게임 시작 후 30초 경과
+    scoreManager->setGameStartTime(GameClock::time_point());
+    scoreManager->updateGameTime(GameClock::time_point(std::chrono::seconds(30)));
     
     // 파일 저장
     scoreManager->saveToFile(testFilename);
@@ -0,0 +1,556 @@
+#include <gtest/gtest.h>
+#include "Simulation.hpp"
+#include <algorithm>
+#include <vector>
+#include <cstdlib>
+
+class SimulationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 고정 시드 (Gate/아이템 위치에 따라 결과가 달라지지 않도록)
+        simulation = new Simulation(31, 31, 12345);
+    }
+
+    void TearDown() override {
+        delete simulation;
+    }
+
+    // 본문을 고친 스냅샷의 검사합을 다시 계산 (31x31 머리: 매직 4 + 버전 1 + 크기 varint 2, 검사합 8)
+    static void reseal(std::vector<uint8_t>& bytes) {
+        const size_t checksumPos = 7;
+        const size_t bodyPos = checksumPos + 8;
+        uint64_t checksum = stateChecksum(bytes.data() + bodyPos, bytes.size() - bodyPos);
+        for (size_t i = 0; i < 8; i++) {
+            bytes[checksumPos + i] = static_cast<uint8_t>(checksum >> (8 * i));
+        }
+    }
+
+    // 본문 끝의 속도/자동 생성 타이머 필드 인코딩 (saveSnapshot과 같은 순서)
+    static std::vector<uint8_t> encodeTail(int tickDuration, int speedBoostCount,
+                                           GameClock::time_point lastCreation, int interval) {
+        std::vector<uint8_t> tail;
+        StateWriter writer(tail);
+        writer.writeInt(tickDuration);
+        writer.writeInt(speedBoostCount);
+        writer.writeInt(lastCreation.time_since_epoch().count());
+        writer.writeInt(interval);
+        return tail;
+    }
+
+    // 스냅샷에서 맵 셀 배열의 시작 위치 (머리 15 + 시드 8 + 시계)
+    static size_t mapCellsOffset(const Simulation& source) {
+        std::vector<uint8_t> clockBytes;
+        StateWriter writer(clockBytes);
+        source.getClock().saveState(writer);
+        return 15 + 8 + clockBytes.size();
+    }
+
+    // 스냅샷에서 Gate 부분의 시작 위치 (앞 부분을 같은 순서로 다시 인코딩해 길이 계산)
+    static size_t gateSectionOffset(const Simulation& source) {
+        std::vector<uint8_t> prefix;
+        StateWriter writer(prefix);
+        writer.writeFixed64(source.getSeed());
+        source.getClock().saveState(writer);
+        source.getMap().saveState(writer);
+        source.getSnake().saveState(writer);
+        source.getItemManager().saveState(writer);
+        return 15 + prefix.size();
+    }
+
+    // Gate 목록과 진입 상태 인코딩 (GateManager::saveState의 앞부분)
+    static std::vector<uint8_t> encodeGates(const std::vector<Gate>& gates, int originalWallValue,
+                                            const std::vector<Position>& entering) {
+        std::vector<uint8_t> bytes;
+        StateWriter writer(bytes);
+        writer.writeVarint(gates.size());
+        for (const auto& gate : gates) {
+            writer.writeInt(gate.getX());
+            writer.writeInt(gate.getY());
+            writer.writeByte(static_cast<uint8_t>(gate.getType()));
+            writer.writeByte(static_cast<uint8_t>(gate.getWallType()));
+            writer.writeInt(gate.getPairId());
+            writer.writeInt(originalWallValue > 0 ? originalWallValue : gate.getOriginalWallValue());
+            writer.writeInt(gate.getCreationTime().time_since_epoch().count());
+        }
+        writer.writeVarint(entering.size());
+        for (const auto& pos : entering) {
+            writer.writeInt(pos.x);
+            writer.writeInt(pos.y);
+            writer.writeBool(true);
+        }
+        return bytes;
+    }
+
+    // Gate가 있고 진입 상태가 없는 틱까지 진행한 뒤 Gate 목록 부분을 바꾼 스냅샷 생성
+    std::vector<uint8_t> snapshotWithGates(int originalWallValue, const std::vector<Position>& entering) {
+        for (int tick = 0; tick < 50 && simulation->getGateManager().getGates().empty(); tick++) {
+            simulation->update();
+        }
+        const std::vector<Gate>& gates = simulation->getGateManager().getGates();
+        EXPECT_FALSE(gates.empty());
+        std::vector<uint8_t> snapshot = simulation->saveSnapshot();
+        size_t offset = gateSectionOffset(*simulation);
+        std::vector<uint8_t> original = encodeGates(gates, 0, {});
+        EXPECT_TRUE(std::equal(original.begin(), original.end(), snapshot.begin() + offset));
+
+        std::vector<uint8_t> replaced = encodeGates(gates, originalWallValue, entering);
+        std::vector<uint8_t> bytes(snapshot.begin(), snapshot.begin() + offset);
+        bytes.insert(bytes.end(), replaced.begin(), replaced.end());
+        bytes.insert(bytes.end(), snapshot.begin() + offset + original.size(), snapshot.end());
+        reseal(bytes);
+        return bytes;
+    }
+
+    Simulation* simulation;
+};
+
+// 초기화 테스트
+TEST_F(SimulationTest, InitializationTest) {
+    EXPECT_FALSE(simulation->isGameOver());
+    EXPECT_FALSE(simulation->isGameCompleted());
+    EXPECT_EQ(simulation->getSnake().getLength(), 3);
+    EXPECT_EQ(simulation->getScoreManager().getCurrentLength(), 3);
+    EXPECT_EQ(simulation->getCurrentTickDuration(), 200);
+}
+
+// 방향 전환 행동 테스트
+TEST_F(SimulationTest, TurnActionTest) {
+    simulation->applyAction(GameAction::TURN_UP);
+    EXPECT_EQ(simulation->getSnake().getDirection(), Direction::UP);
+
+    // 반대 방향은 무시되어야 함
+    simulation->applyAction(GameAction::TURN_DOWN);
+    EXPECT_EQ(simulation->getSnake().getDirection(), Direction::UP);
+
+    simulation->applyAction(GameAction::TURN_LEFT);
+    EXPECT_EQ(simulation->getSnake().getDirection(), Direction::LEFT);
+
+    simulation->applyAction(GameAction::NONE);
+    EXPECT_EQ(simulation->getSnake().getDirection(), Direction::LEFT);
+}
+
+// 벽 설치 행동 테스트
+TEST_F(SimulationTest, PlaceWallActionTest) {
+    simulation->applyAction(GameAction::PLACE_WALL);
+
+    // 뱀 몸통 쪽을 제외한 머리 주변 빈 칸에 생성됨
+    EXPECT_GT(simulation->getTemporaryWallManager().getTemporaryWallCount(), 0);
+}
+
+// 종료 행동 테스트
+TEST_F(SimulationTest, QuitActionTest) {
+    simulation->applyAction(GameAction::QUIT);
+    EXPECT_TRUE(simulation->isGameOver());
+
+    // 게임 오버 이후에는 업데이트되지 않아야 함
+    Position head = simulation->getSnake().getHead();
+    simulation->update();
+    EXPECT_EQ(simulation->getSnake().getHead(), head);
+}
+
+// 헤드리스 업데이트 테스트
+TEST_F(SimulationTest, HeadlessUpdateTest) {
+    Position head = simulation->getSnake().getHead();
+    simulation->update();
+
+    Position newHead = simulation->getSnake().getHead();
+    EXPECT_EQ(newHead.x, head.x + 1);
+    EXPECT_EQ(newHead.y, head.y);
+
+    // 맵에 뱀 머리가 반영되어야 함
+    EXPECT_EQ(simulation->getMap().getCellValue(newHead.x, newHead.y), 3);
+}
+
+// 벽 충돌 테스트
+TEST_F(SimulationTest, WallCollisionTest) {
+    simulation->applyAction(GameAction::TURN_UP);
+    for (int i = 0; i < 20 && !simulation->isGameOver(); i++) {
+        simulation->update();
+    }
+    EXPECT_TRUE(simulation->isGameOver());
+    EXPECT_FALSE(simulation->isGameCompleted());
+}
+
+// 증분 맵 갱신과 전체 재구성 결과 비교 테스트
+TEST_F(SimulationTest, IncrementalMapMatchesRebuildTest) {
+    simulation->setMapVerification(true);
+    simulation->setLastTemporaryWallCreation(simulation->getClock().now());
+
+    // 벽에 부딪히지 않도록 사각형을 그리며 이동하면서 아이템/Gate/벽 생성·만료를 거침
+    const GameAction turns[] = {
+        GameAction::TURN_UP, GameAction::TURN_LEFT, GameAction::TURN_DOWN, GameAction::TURN_RIGHT
+    };
+    for (int tick = 0; tick < 200 && !simulation->isGameOver(); tick++) {
+        if (tick % 4 == 0) {
+            simulation->applyAction(turns[(tick / 4) % 4]);
+        }
+        if (tick % 25 == 0) {
+            // 뱀 경로에서 먼 곳에 짧은 수명의 Temporary Wall 생성
+            simulation->getTemporaryWallManager().addTemporaryWall(
+                Position(2 + tick % 5, 2), std::chrono::milliseconds(1000));
+        }
+        simulation->update();
+    }
+
+    EXPECT_GT(simulation->getClock().getTickCount(), 50);
+    EXPECT_EQ(simulation->getMapMismatchCount(), 0);
+}
+
+// 만료된 Temporary Wall 셀이 맵에서 지워지는지 테스트
+TEST_F(SimulationTest, ExpiredTemporaryWallClearedFromMapTest) {
+    simulation->setLastTemporaryWallCreation(simulation->getClock().now());
+    simulation->getTemporaryWallManager().addTemporaryWall(Position(5, 5), std::chrono::milliseconds(300));
+
+    simulation->update();
+    EXPECT_EQ(simulation->getMap().getCellValue(5, 5), 9);
+
+    simulation->update();
+    EXPECT_EQ(simulation->getTemporaryWallManager().getTemporaryWallCount(), 0);
+    EXPECT_EQ(simulation->getMap().getCellValue(5, 5), 0);
+}
+
+// 같은 시드와 같은 입력이면 게임 전체가 재현되는지 테스트
+TEST_F(SimulationTest, SeedReproducesGameTest) {
+    Simulation first(31, 31, 2024);
+    Simulation second(31, 31, 2024);
+    EXPECT_EQ(first.getSeed(), 2024u);
+
+    const GameAction turns[] = {
+        GameAction::TURN_UP, GameAction::TURN_LEFT, GameAction::TURN_DOWN, GameAction::TURN_RIGHT
+    };
+    for (int tick = 0; tick < 150 && !first.isGameOver(); tick++) {
+        if (tick % 4 == 0) {
+            first.applyAction(turns[(tick / 4) % 4]);
+            second.applyAction(turns[(tick / 4) % 4]);
+        }
+        first.update();
+        second.update();
+
+        ASSERT_EQ(first.isGameOver(), second.isGameOver());
+        for (int y = 0; y < 31; y++) {
+            for (int x = 0; x < 31; x++) {
+                ASSERT_EQ(first.getMap().getCellValue(x, y), second.getMap().getCellValue(x, y))
+                    << "tick " << tick << " at (" << x << ", " << y << ")";
+            }
+        }
+    }
+    EXPECT_EQ(first.getScoreManager().getTotalScore(), second.getScoreManager().getTotalScore());
+}
+
+// 진행한 게임을 새 시드로 되돌리면 새로 만든 게임과 같은 상태/미래인지 테스트
+TEST_F(SimulationTest, ResetMatchesFreshSimulationTest) {
+    const GameAction turns[] = {
+        GameAction::TURN_UP, GameAction::TURN_LEFT, GameAction::TURN_DOWN, GameAction::TURN_RIGHT
+    };
+    for (int tick = 0; tick < 80 && !simulation->isGameOver(); tick++) {
+        if (tick % 4 == 0) {
+            simulation->applyAction(turns[(tick / 4) % 4]);
+        }
+        simulation->update();
+    }
+
+    simulation->reset(2024);
+    Simulation fresh(31, 31, 2024);
+    EXPECT_EQ(simulation->getSeed(), 2024u);
+    EXPECT_EQ(simulation->getClock().getTickCount(), 0);
+    EXPECT_EQ(simulation->saveSnapshot(), fresh.saveSnapshot());
+
+    for (int tick = 0; tick < 150 && !fresh.isGameOver(); tick++) {
+        if (tick % 4 == 0) {
+            simulation->applyAction(turns[(tick / 4) % 4]);
+            fresh.applyAction(turns[(tick / 4) % 4]);
+        }
+        simulation->update();
+        fresh.update();
+        ASSERT_EQ(simulation->saveSnapshot(), fresh.saveSnapshot()) << "tick " << tick;
+    }
+}
+
+// 스냅샷으로 되감으면 같은 입력에 대해 같은 미래가 나오는지 테스트
+TEST_F(SimulationTest, SnapshotRestoreReproducesFutureTest) {
+    const GameAction turns[] = {
+        GameAction::TURN_UP, GameAction::TURN_LEFT, GameAction::TURN_DOWN, GameAction::TURN_RIGHT
+    };
+    auto play = [&turns](Simulation& sim, int from, int ticks) {
+        std::vector<std::vector<uint8_t>> frames;
+        for (int tick = from; tick < from + ticks && !sim.isGameOver(); tick++) {
+            if (tick % 4 == 0) {
+                sim.applyAction(turns[(tick / 4) % 4]);
+            }
+            if (tick % 25 == 0) {
+                // 뱀 경로에서 먼 곳에 짧은 수명의 Temporary Wall 생성 (만료 일정도 복원 대상)
+                sim.getTemporaryWallManager().addTemporaryWall(
+                    Position(2 + tick % 5, 2), std::chrono::milliseconds(1000));
+            }
+            sim.update();
+            frames.emplace_back(31 * 31);
+            sim.getMap().copyCellsTo(frames.back().data());
+        }
+        return frames;
+    };
+
+    play(*simulation, 0, 40);
+    std::vector<uint8_t> snapshot = simulation->saveSnapshot();
+    ScoreManager scoreAtSnapshot = simulation->getScoreManager();
+    auto original = play(*simulation, 40, 120);
+    ASSERT_GT(original.size(), 20u);
+
+    // 같은 객체로 되감기
+    ASSERT_TRUE(simulation->restoreSnapshot(snapshot));
+    EXPECT_EQ(simulation->getScoreManager().getTotalScore(), scoreAtSnapshot.getTotalScore());
+    EXPECT_EQ(play(*simulation, 40, 120), original);
+
+    // 시드가 다른 새 게임에 복원
+    Simulation other(31, 31, 999);
+    ASSERT_TRUE(other.restoreSnapshot(snapshot));
+    EXPECT_EQ(other.getSeed(), 12345u);
+    EXPECT_EQ(play(other, 40, 120), original);
+    EXPECT_EQ(other.getScoreManager().getTotalScore(), simulation->getScoreManager().getTotalScore());
+    EXPECT_EQ(other.getClock().getTickCount(), simulation->getClock().getTickCount());
+}
+
+// 손상되었거나 크기가 다른 스냅샷은 상태를 바꾸지 않고 거부하는지 테스트
+TEST_F(SimulationTest, SnapshotRejectsInvalidDataTest) {
+    simulation->update();
+    std::vector<uint8_t> snapshot = simulation->saveSnapshot();
+    simulation->update();
+    Position head = simulation->getSnake().getHead();
+
+    std::vector<uint8_t> corrupted = snapshot;
+    corrupted[corrupted.size() / 2] ^= 0x40;
+    EXPECT_FALSE(simulation->restoreSnapshot(corrupted));
+
+    std::vector<uint8_t> truncated(snapshot.begin(), snapshot.end() - 1);
+    EXPECT_FALSE(simulation->restoreSnapshot(truncated));
+
+    Simulation smaller(21, 21, 1);
+    EXPECT_FALSE(smaller.restoreSnapshot(snapshot));
+    EXPECT_FALSE(simulation->restoreSnapshot(smaller.saveSnapshot()));
+
+    EXPECT_EQ(simulation->getSnake().getHead(), head);
+    EXPECT_EQ(simulation->getClock().getTickCount(), 2);
+}
+
+// 검사합은 맞지만 본문을 끝까지 읽을 수 없는 스냅샷도 상태를 바꾸지 않는지 테스트
+TEST_F(SimulationTest, SnapshotRejectsMalformedBodyWithoutPartialRestoreTest) {
+    std::vector<uint8_t> snapshot = simulation->saveSnapshot();
+    for (int i = 0; i < 5; i++) {
+        simulation->update();
+    }
+    std::vector<uint8_t> before = simulation->saveSnapshot();
+    uint64_t changeCount = simulation->getMap().getChangeCount();
+
+    // 본문 뒤에 바이트를 덧붙이고 검사합을 다시 계산
+    std::vector<uint8_t> tampered = snapshot;
+    tampered.push_back(0);
+    reseal(tampered);
+
+    EXPECT_FALSE(simulation->restoreSnapshot(tampered));
+    EXPECT_EQ(simulation->saveSnapshot(), before);
+    EXPECT_EQ(simulation->getMap().getChangeCount(), changeCount);
+    EXPECT_TRUE(simulation->restoreSnapshot(snapshot));
+}
+
+// 틱 지속시간/부스트 횟수/자동 생성 간격이 범위를 벗어난 스냅샷을 거부하는지 테스트
+TEST_F(SimulationTest, SnapshotRejectsOutOfRangeTimingTest) {
+    simulation->update();
+    std::vector<uint8_t> snapshot = simulation->saveSnapshot();
+    GameClock::time_point lastCreation = simulation->getLastTemporaryWallCreation();
+    int interval = simulation->getTemporaryWallCreationInterval();
+    std::vector<uint8_t> tail = encodeTail(simulation->getCurrentTickDuration(), simulation->getSpeedBoostCount(),
+                                           lastCreation, interval);
+    ASSERT_GE(snapshot.size(), tail.size());
+    ASSERT_TRUE(std::equal(tail.begin(), tail.end(), snapshot.end() - tail.size()));
+
+    auto withTail = [&](int tickDuration, int speedBoostCount, int newInterval) {
+        std::vector<uint8_t> bytes(snapshot.begin(), snapshot.end() - tail.size());
+        std::vector<uint8_t> replaced = encodeTail(tickDuration, speedBoostCount, lastCreation, newInterval);
+        bytes.insert(bytes.end(), replaced.begin(), replaced.end());
+        reseal(bytes);
+        return bytes;
+    };
+
+    simulation->update();
+    std::vector<uint8_t> before = simulation->saveSnapshot();
+    EXPECT_FALSE(simulation->restoreSnapshot(withTail(0, 0, interval)));
+    EXPECT_FALSE(simulation->restoreSnapshot(withTail(49, 0, interval)));
+    EXPECT_FALSE(simulation->restoreSnapshot(withTail(201, 0, interval)));
+    EXPECT_FALSE(simulation->restoreSnapshot(withTail(200, -1, interval)));
+    EXPECT_FALSE(simulation->restoreSnapshot(withTail(200, 0, 0)));
+    EXPECT_FALSE(simulation->restoreSnapshot(withTail(200, 0, -20000)));
+    EXPECT_EQ(simulation->saveSnapshot(), before);
+
+    // 범위 안의 값은 그대로 복원
+    ASSERT_TRUE(simulation->restoreSnapshot(withTail(50, 3, 1)));
+    EXPECT_EQ(simulation->getCurrentTickDuration(), 50);
+    EXPECT_EQ(simulation->getSpeedBoostCount(), 3);
+    EXPECT_EQ(simulation->getTemporaryWallCreationInterval(), 1);
+}
+
+// 셀 값이 0~9를 벗어난 스냅샷을 거부하는지 테스트
+TEST_F(SimulationTest, SnapshotRejectsInvalidCellValueTest) {
+    std::vector<uint8_t> snapshot = simulation->saveSnapshot();
+    size_t cell = mapCellsOffset(*simulation) + 5 * 31 + 5;
+    ASSERT_EQ(snapshot[cell], simulation->getMap().getCellValue(5, 5));
+    std::vector<uint8_t> before = simulation->saveSnapshot();
+
+    std::vector<uint8_t> tampered = snapshot;
+    tampered[cell] = 10;
+    reseal(tampered);
+    EXPECT_FALSE(simulation->restoreSnapshot(tampered));
+    EXPECT_EQ(simulation->saveSnapshot(), before);
+}
+
+// 빈 셀 인덱스가 빈 칸이 아닌 셀을 가리키는 스냅샷을 거부하는지 테스트
+TEST_F(SimulationTest, SnapshotRejectsFreeIndexMismatchTest) {
+    std::vector<uint8_t> snapshot = simulation->saveSnapshot();
+    ASSERT_EQ(simulation->getMap().getCellValue(5, 5), 0);
+    size_t cell = mapCellsOffset(*simulation) + 5 * 31 + 5;
+
+    // 셀만 Growth로 바꾸고 인덱스는 그대로 (빈 셀 인덱스에 남은 슬롯이 0이 아닌 셀)
+    std::vector<uint8_t> tampered = snapshot;
+    tampered[cell] = 5;
+    reseal(tampered);
+    EXPECT_FALSE(simulation->restoreSnapshot(tampered));
+    EXPECT_EQ(simulation->saveSnapshot(), snapshot);
+    EXPECT_TRUE(simulation->restoreSnapshot(snapshot));
+}
+
+// Gate가 되돌릴 벽 값이 벽(1, 2)이 아닌 스냅샷을 거부하는지 테스트
+TEST_F(SimulationTest, SnapshotRejectsInvalidGateWallValueTest) {
+    std::vector<uint8_t> valid = snapshotWithGates(0, {});
+    std::vector<uint8_t> tampered = snapshotWithGates(5, {});
+    std::vector<uint8_t> before = simulation->saveSnapshot();
+
+    EXPECT_FALSE(simulation->restoreSnapshot(tampered));
+    EXPECT_EQ(simulation->saveSnapshot(), before);
+    EXPECT_TRUE(simulation->restoreSnapshot(valid));
+}
+
+// Gate가 없는 칸의 진입 상태가 담긴 스냅샷을 거부하는지 테스트
+TEST_F(SimulationTest, SnapshotRejectsEnteringStateOffGateTest) {
+    std::vector<uint8_t> tampered = snapshotWithGates(0, {Position(15, 15)});
+    ASSERT_FALSE(simulation->getGateManager().hasGateAt(15, 15));
+    std::vector<uint8_t> before = simulation->saveSnapshot();
+    EXPECT_FALSE(simulation->restoreSnapshot(tampered));
+    EXPECT_EQ(simulation->saveSnapshot(), before);
+
+    // Gate 칸의 진입 상태는 복원
+    Position gate(simulation->getGateManager().getGates()[0].getX(), simulation->getGateManager().getGates()[0].getY());
+    EXPECT_TRUE(simulation->restoreSnapshot(snapshotWithGates(0, {gate})));
+    EXPECT_TRUE(simulation->getGateManager().isSnakeEntering(gate));
+}
+
+// 복원한 셀 변경이 맵 변경 기록에 남는지 테스트
+TEST_F(SimulationTest, SnapshotRestoreRecordsMapChangesTest) {
+    std::vector<uint8_t> snapshot = simulation->saveSnapshot();
+    for (int i = 0; i < 3; i++) {
+        simulation->update();
+    }
+    uint64_t before = simulation->getMap().getChangeCount();
+
+    ASSERT_TRUE(simulation->restoreSnapshot(snapshot));
+    const GameMap& map = simulation->getMap();
+    EXPECT_GT(map.getChangeCount(), before);
+    Position head = simulation->getSnake().getHead();
+    EXPECT_EQ(map.getCellValue(head.x, head.y), 3);
+}
+
+// 포크가 부모와 같은 미래를 독립적으로 진행하는지 테스트
+TEST_F(SimulationTest, ForkReproducesFutureIndependentlyTest) {
+    const GameAction turns[] = {
+        GameAction::TURN_UP, GameAction::TURN_LEFT, GameAction::TURN_DOWN, GameAction::TURN_RIGHT
+    };
+    for (int tick = 0; tick < 30 && !simulation->isGameOver(); tick++) {
+        if (tick % 4 == 0) {
+            simulation->applyAction(turns[(tick / 4) % 4]);
+        }
+        simulation->update();
+    }
+    ASSERT_FALSE(simulation->isGameOver());
+    std::vector<uint8_t> before = simulation->saveSnapshot();
+
+    // 자식은 벽을 향해 달려 게임 오버 (부모에는 영향 없음)
+    auto crashed = simulation->fork();
+    crashed->applyAction(GameAction::TURN_UP);
+    for (int i = 0; i < 40 && !crashed->isGameOver(); i++) {
+        crashed->update();
+    }
+    EXPECT_TRUE(crashed->isGameOver());
+    EXPECT_FALSE(simulation->isGameOver());
+    EXPECT_EQ(simulation->saveSnapshot(), before);
+
+    // 같은 입력을 주면 자식과 부모의 결과가 같아야 함
+    auto child = simulation->fork();
+    for (int tick = 30; tick < 130 && !simulation->isGameOver(); tick++) {
+        if (tick % 4 == 0) {
+            simulation->applyAction(turns[(tick / 4) % 4]);
+            child->applyAction(turns[(tick / 4) % 4]);
+        }
+        simulation->update();
+        child->update();
+        ASSERT_EQ(child->saveSnapshot(), simulation->saveSnapshot()) << "tick " << tick;
+    }
+    EXPECT_EQ(child->getScoreManager().getTotalScore(), simulation->getScoreManager().getTotalScore());
+}
+
+// 포크한 자식의 미션 진행도가 부모 스테이지를 바꾸지 않는지 테스트
+TEST_F(SimulationTest, ForkKeepsStageProgressSeparateTest) {
+    auto child = simulation->fork();
+    child->getStageManager().updateMissionProgress(MissionType::GROWTH_ITEMS, 1);
+
+    EXPECT_TRUE(child->getStageManager().isCurrentStageCompleted());
+    EXPECT_FALSE(simulation->getStageManager().isCurrentStageCompleted());
+    EXPECT_EQ(simulation->getStageManager().getCurrentStage()->getMission(0)->getCurrentValue(), 0);
+}
+
+// 큰 맵에서도 Temporary Wall을 뱀과 떨어진 서로 다른 빈 칸에 만드는지 테스트
+TEST_F(SimulationTest, RandomTemporaryWallsOnLargeMapTest) {
+    Simulation large(2049, 2049, 7);
+    for (int round = 0; round < 20; round++) {
+        large.createRandomTemporaryWalls();
+        const auto& walls = large.getTemporaryWallManager().getTemporaryWalls();
+        ASSERT_EQ(walls.size(), 2);
+        EXPECT_NE(walls[0].getPosition(), walls[1].getPosition());
+        for (const auto& wall : walls) {
+            Position position = wall.getPosition();
+            EXPECT_EQ(large.getMap().getCellValue(position.x, position.y), 0);
+            for (const Position& segment : large.getSnake().getBody()) {
+                EXPECT_GE(std::abs(segment.x - position.x) + std::abs(segment.y - position.y), 3);
+            }
+        }
+        large.getTemporaryWallManager().clear();
+    }
+}
+
+// 뱀 주변을 빼면 빈 칸이 거의 없어도 남은 자리를 찾는지 테스트 (무작위 추출 실패 후 순회)
+TEST_F(SimulationTest, RandomTemporaryWallsOnCrowdedMapTest) {
+    // 뱀에서 2칸 이내(벽을 둘 수 없는 칸)와 모서리 두 칸만 비워 둠
+    GameMap& map = simulation->getMap();
+    const Snake& snake = simulation->getSnake();
+    for (int y = 1; y < map.getHeight() - 1; y++) {
+        for (int x = 1; x < map.getWidth() - 1; x++) {
+            bool nearSnake = false;
+            for (const Position& segment : snake.getBody()) {
+                nearSnake = nearSnake || std::abs(segment.x - x) + std::abs(segment.y - y) <= 2;
+            }
+            bool spare = (x == 1 && y == 1) || (x == 29 && y == 29);
+            if (!nearSnake && !spare) {
+                map.setCellValue(x, y, 1);
+            }
+        }
+    }
+
+    for (int round = 0; round < 10; round++) {
+        simulation->createRandomTemporaryWalls();
+        const auto& walls = simulation->getTemporaryWallManager().getTemporaryWalls();
+        ASSERT_EQ(walls.size(), 2);
+        EXPECT_NE(walls[0].getPosition(), walls[1].getPosition());
+        for (const auto& wall : walls) {
+            Position position = wall.getPosition();
+            EXPECT_TRUE(position == Position(1, 1) || position == Position(29, 29))
+                << position.x << ", " << position.y;
+        }
+        simulation->getTemporaryWallManager().clear();
+    }
+}
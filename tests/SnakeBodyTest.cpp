@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "SnakeBody.hpp"
+#include <vector>
+
+class SnakeBodyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        body = new SnakeBody(4);  // 작은 용량으로 시작해 확장/순환을 확인
+    }
+
+    void TearDown() override {
+        delete body;
+    }
+
+    SnakeBody* body;
+};
+
+// 초기 상태 테스트
+TEST_F(SnakeBodyTest, InitializationTest) {
+    EXPECT_TRUE(body->empty());
+    EXPECT_EQ(body->size(), 0);
+    EXPECT_EQ(body->capacity(), 4);
+}
+
+// 머리 추가와 꼬리 제거 순서 테스트
+TEST_F(SnakeBodyTest, PushFrontPopBackTest) {
+    body->push_front(Position(1, 0));
+    body->push_front(Position(2, 0));
+    body->push_front(Position(3, 0));
+
+    EXPECT_EQ(body->size(), 3);
+    EXPECT_EQ(body->front(), Position(3, 0));  // 마지막에 추가한 것이 머리
+    EXPECT_EQ(body->back(), Position(1, 0));
+    EXPECT_EQ((*body)[1], Position(2, 0));
+
+    body->pop_back();
+    EXPECT_EQ(body->size(), 2);
+    EXPECT_EQ(body->back(), Position(2, 0));
+}
+
+// 버퍼 경계를 넘어 순환해도 순서가 유지되는지 테스트
+TEST_F(SnakeBodyTest, WrapAroundTest) {
+    for (int i = 0; i < 3; i++) {
+        body->push_back(Position(-i, 0));
+    }
+
+    // 이동을 여러 번 반복 (머리 추가 + 꼬리 제거)
+    for (int step = 1; step <= 10; step++) {
+        body->push_front(Position(step, 0));
+        body->pop_back();
+    }
+
+    EXPECT_EQ(body->capacity(), 4);  // 길이가 그대로면 재할당 없음
+    EXPECT_EQ(body->size(), 3);
+    EXPECT_EQ((*body)[0], Position(10, 0));
+    EXPECT_EQ((*body)[1], Position(9, 0));
+    EXPECT_EQ((*body)[2], Position(8, 0));
+}
+
+// 용량 확장 시 머리부터의 순서 유지 테스트
+TEST_F(SnakeBodyTest, ExpandTest) {
+    body->push_back(Position(0, 0));
+    body->push_back(Position(1, 0));
+    body->push_front(Position(-1, 0));
+    body->push_front(Position(-2, 0));
+    body->push_back(Position(2, 0));  // 확장 발생
+
+    EXPECT_EQ(body->size(), 5);
+    EXPECT_EQ(body->capacity(), 8);
+
+    std::vector<Position> expected = {
+        Position(-2, 0), Position(-1, 0), Position(0, 0), Position(1, 0), Position(2, 0)
+    };
+    std::vector<Position> actual(body->begin(), body->end());
+    EXPECT_EQ(actual, expected);
+}
+
+// 범위 기반 for 순회 및 초기화 테스트
+TEST_F(SnakeBodyTest, IterationAndClearTest) {
+    body->push_back(Position(5, 5));
+    body->push_back(Position(4, 5));
+
+    int visited = 0;
+    for (const auto& segment : *body) {
+        EXPECT_EQ(segment.y, 5);
+        visited++;
+    }
+    EXPECT_EQ(visited, 2);
+
+    body->clear();
+    EXPECT_TRUE(body->empty());
+    EXPECT_EQ(body->begin(), body->end());
+}
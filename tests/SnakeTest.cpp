@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include "Snake.hpp"
+#include "StateStream.hpp"
+#include <vector>
 
 class SnakeTest : public ::testing::Test {
 protected:
@@ -122,4 +124,99 @@ TEST_F(SnakeTest, ResetTest) {
     EXPECT_EQ(body[1].y, 5);
     EXPECT_EQ(body[2].x, 3);  // 꼬리
     EXPECT_EQ(body[2].y, 5);
-} 
\ No newline at end of file
+} 
+
+// 셀 점유 인덱스 테스트
+TEST_F(SnakeTest, OccupancyTest) {
+    // 초기 몸통 (10,10), (9,10), (8,10)
+    EXPECT_TRUE(snake->isOccupied(10, 10));
+    EXPECT_TRUE(snake->isOccupied(9, 10));
+    EXPECT_TRUE(snake->isOccupied(8, 10));
+    EXPECT_FALSE(snake->isOccupied(11, 10));
+    EXPECT_FALSE(snake->isOccupied(-5, 100));  // 범위 밖 좌표는 비어 있음
+
+    // 이동하면 새 머리는 점유, 빠진 꼬리는 해제
+    snake->move();
+    EXPECT_TRUE(snake->isOccupied(11, 10));
+    EXPECT_FALSE(snake->isOccupied(8, 10));
+
+    // 성장 시 꼬리 셀은 중복 점유됨
+    snake->grow();
+    EXPECT_EQ(snake->getOccupancy(9, 10), 2);
+
+    // 독 아이템으로 꼬리 하나 제거
+    EXPECT_TRUE(snake->applyPoisonItem());
+    EXPECT_EQ(snake->getOccupancy(9, 10), 1);
+
+    // 텔레포트는 머리 셀만 옮김
+    snake->teleportTo(Position(20, 3));
+    EXPECT_FALSE(snake->isOccupied(11, 10));
+    EXPECT_TRUE(snake->isOccupied(20, 3));
+
+    // 리셋하면 이전 몸통은 모두 해제
+    snake->reset(5, 5);
+    EXPECT_FALSE(snake->isOccupied(20, 3));
+    EXPECT_FALSE(snake->isOccupied(10, 10));
+    EXPECT_TRUE(snake->isOccupied(3, 5));
+}
+
+// 초기 범위를 벗어난 좌표에서도 점유 인덱스가 유지되는지 테스트
+TEST_F(SnakeTest, OccupancyExpansionTest) {
+    snake->teleportTo(Position(500, -40));
+    EXPECT_TRUE(snake->isOccupied(500, -40));
+
+    // 확장 후에도 기존 마디 정보가 보존되어야 함
+    EXPECT_TRUE(snake->isOccupied(9, 10));
+    EXPECT_TRUE(snake->isOccupied(8, 10));
+    EXPECT_FALSE(snake->isOccupied(10, 10));
+
+    // 확장된 영역에서 이동해도 충돌 판정이 정상이어야 함
+    snake->move();
+    EXPECT_TRUE(snake->isOccupied(501, -40));
+    EXPECT_FALSE(snake->checkSelfCollision());
+}
+
+// 맵 밖 좌표가 담긴 상태는 몸통을 바꾸지 않고 거부하는지 테스트
+TEST_F(SnakeTest, LoadStateRejectsOutOfMapPositionTest) {
+    std::vector<uint8_t> bytes;
+    StateWriter writer(bytes);
+    writer.writeByte(static_cast<uint8_t>(Direction::UP));
+    writer.writeBool(false);
+    writer.writeVarint(3);
+    const int coordinates[][2] = {{5, 5}, {5, 6}, {1000000, 7}};
+    for (const auto& coordinate : coordinates) {
+        writer.writeInt(coordinate[0]);
+        writer.writeInt(coordinate[1]);
+    }
+    writer.writeVarint(0);
+
+    StateReader reader(bytes);
+    EXPECT_FALSE(snake->loadState(reader, 21, 21));
+    EXPECT_EQ(snake->getHead(), Position(10, 10));
+    EXPECT_EQ(snake->getLength(), 3);
+    EXPECT_EQ(snake->getDirection(), Direction::RIGHT);
+    EXPECT_FALSE(snake->isOccupied(5, 5));
+
+    // 같은 몸통이라도 맵 안이면 복원
+    std::vector<uint8_t> valid;
+    StateWriter validWriter(valid);
+    validWriter.writeByte(static_cast<uint8_t>(Direction::UP));
+    validWriter.writeBool(false);
+    validWriter.writeVarint(3);
+    for (int y = 5; y < 8; y++) {
+        validWriter.writeInt(5);
+        validWriter.writeInt(y);
+    }
+    validWriter.writeVarint(1);
+    validWriter.writeInt(5);
+    validWriter.writeInt(8);
+
+    StateReader validReader(valid);
+    EXPECT_TRUE(snake->loadState(validReader, 21, 21));
+    EXPECT_EQ(snake->getHead(), Position(5, 5));
+    EXPECT_EQ(snake->getDirection(), Direction::UP);
+    EXPECT_TRUE(snake->isOccupied(5, 7));
+    EXPECT_FALSE(snake->isOccupied(10, 10));
+    ASSERT_EQ(snake->getChangedCells().size(), 1u);
+    EXPECT_EQ(snake->getChangedCells()[0], Position(5, 8));
+}
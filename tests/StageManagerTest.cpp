@@ -183,4 +183,26 @@ TEST_F(StageManagerTest, GetStageInfoTest) {
     stageManager->nextStage();
     const Stage* stage4 = stageManager->getCurrentStage();
     EXPECT_EQ(stage4->getStageName(), "Box Stage");
-} 
\ No newline at end of file
+} 
+// 복사한 StageManager가 스테이지를 공유하다가 진행도를 바꿀 때 분리되는지 테스트
+TEST_F(StageManagerTest, CopyOnWriteStagesTest) {
+    StageManager copy = *stageManager;
+    EXPECT_EQ(copy.getCurrentStage(), stageManager->getCurrentStage());  // 같은 스테이지 객체 공유
+
+    copy.updateMissionProgress(MissionType::GROWTH_ITEMS, 1);
+    EXPECT_NE(copy.getCurrentStage(), stageManager->getCurrentStage());
+    EXPECT_TRUE(copy.isCurrentStageCompleted());
+    EXPECT_FALSE(stageManager->isCurrentStageCompleted());
+
+    // 복제된 스테이지도 같은 벽 레이아웃을 적용해야 함
+    copy.nextStage();
+    stageManager->nextStage();
+    GameMap copyMap(31, 31);
+    copy.applyCurrentStageToMap(copyMap);
+    stageManager->applyCurrentStageToMap(*gameMap);
+    for (int y = 0; y < 31; y++) {
+        for (int x = 0; x < 31; x++) {
+            EXPECT_EQ(copyMap.getCellValue(x, y), gameMap->getCellValue(x, y));
+        }
+    }
+}
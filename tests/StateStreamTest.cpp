@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "StateStream.hpp"
+#include <cstdint>
+#include <vector>
+
+class StateStreamTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        bytes = new std::vector<uint8_t>();
+        writer = new StateWriter(*bytes);
+    }
+
+    void TearDown() override {
+        delete writer;
+        delete bytes;
+    }
+
+    std::vector<uint8_t>* bytes;
+    StateWriter* writer;
+};
+
+// 기록한 값을 같은 순서로 다시 읽는지 테스트
+TEST_F(StateStreamTest, RoundTripTest) {
+    writer->writeByte(7);
+    writer->writeBool(true);
+    writer->writeVarint(300);
+    writer->writeInt(-5);
+    writer->writeInt(1LL << 40);
+    writer->writeFixed64(0x0123456789ABCDEFULL);
+
+    StateReader reader(*bytes);
+    EXPECT_EQ(reader.readByte(), 7);
+    EXPECT_TRUE(reader.readBool());
+    EXPECT_EQ(reader.readVarint(), 300u);
+    EXPECT_EQ(reader.readInt32(), -5);
+    EXPECT_EQ(reader.readInt(), 1LL << 40);
+    EXPECT_EQ(reader.readFixed64(), 0x0123456789ABCDEFULL);
+    EXPECT_TRUE(reader.ok());
+    EXPECT_TRUE(reader.atEnd());
+}
+
+// 작은 정수는 1바이트로 저장되는지 테스트
+TEST_F(StateStreamTest, CompactIntegerTest) {
+    writer->writeVarint(127);
+    writer->writeInt(-64);
+    writer->writeInt(63);
+    EXPECT_EQ(bytes->size(), 3u);
+
+    writer->writeVarint(128);
+    EXPECT_EQ(bytes->size(), 5u);
+}
+
+// 데이터가 모자라면 실패 상태가 되고 이후 읽기는 0인지 테스트
+TEST_F(StateStreamTest, TruncatedReadFailsTest) {
+    writer->writeVarint(1000);
+    bytes->pop_back();
+
+    StateReader reader(*bytes);
+    EXPECT_EQ(reader.readVarint(), 0u);
+    EXPECT_FALSE(reader.ok());
+    EXPECT_EQ(reader.readByte(), 0);
+    EXPECT_FALSE(reader.ok());
+}
+
+// 범위를 벗어난 개수와 int 값을 거부하는지 테스트
+TEST_F(StateStreamTest, RangeCheckTest) {
+    writer->writeVarint(10);
+    writer->writeInt(1LL << 40);
+
+    StateReader countReader(*bytes);
+    EXPECT_EQ(countReader.readCount(9), 0u);
+    EXPECT_FALSE(countReader.ok());
+
+    StateReader intReader(*bytes);
+    EXPECT_EQ(intReader.readCount(10), 10u);
+    EXPECT_EQ(intReader.readInt32(), 0);
+    EXPECT_FALSE(intReader.ok());
+}
+
+// 검사합이 한 바이트 변경도 잡아내는지 테스트
+TEST_F(StateStreamTest, ChecksumDetectsChangeTest) {
+    for (int i = 0; i < 64; i++) {
+        writer->writeByte(static_cast<uint8_t>(i));
+    }
+    uint64_t original = stateChecksum(bytes->data(), bytes->size());
+    EXPECT_EQ(stateChecksum(bytes->data(), bytes->size()), original);
+
+    (*bytes)[31] ^= 1;
+    EXPECT_NE(stateChecksum(bytes->data(), bytes->size()), original);
+}
@@ -1,20 +1,21 @@
 #include <gtest/gtest.h>
 #include "TemporaryWallManager.hpp"
 #include "GameMap.hpp"
+#include "GameClock.hpp"
 #include <chrono>
-#include <thread>
 
 class TemporaryWallManagerTest : public ::testing::Test {
 protected:
     void SetUp() override {
         map = std::make_unique<GameMap>(31, 31);
-        manager = std::make_unique<TemporaryWallManager>(*map);
+        manager = std::make_unique<TemporaryWallManager>(*map, clock);
     }
 
     void TearDown() override {
         // unique_ptr이 자동으로 메모리 해제
     }
 
+    GameClock clock;
     std::unique_ptr<GameMap> map;
     std::unique_ptr<TemporaryWallManager> manager;
 };
@@ -64,8 +65,8 @@ TEST_F(TemporaryWallManagerTest, TemporaryWallExpirationTest) {
     
     EXPECT_EQ(manager->getTemporaryWallCount(), 2);
     
-    // 150ms 대기 후 업데이트
-    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    // 150ms 경과 후 업데이트
+    clock.advance(std::chrono::milliseconds(150));
     manager->update();
     
     // 짧은 생존 시간의 벽은 제거되고, 긴 생존 시간의 벽은 남아있어야 함
@@ -135,4 +136,23 @@ TEST_F(TemporaryWallManagerTest, OutOfBoundsPositionTest) {
     manager->addTemporaryWall(invalidPos, lifetime);
     EXPECT_EQ(manager->getTemporaryWallCount(), 0);
     EXPECT_FALSE(manager->hasTemporaryWallAt(invalidPos));
-} 
\ No newline at end of file
+} 
+// 같은 위치에 다시 설치한 벽은 새 생존 시간을 따르는지 테스트
+TEST_F(TemporaryWallManagerTest, ReplacedWallKeepsNewLifetimeTest) {
+    Position pos(10, 10);
+    manager->addTemporaryWall(pos, std::chrono::milliseconds(100));
+
+    clock.advance(std::chrono::milliseconds(50));
+    manager->addTemporaryWall(pos, std::chrono::milliseconds(200));
+
+    // 처음 벽의 만료 시각이 지나도 새 벽은 남아 있어야 함
+    clock.advance(std::chrono::milliseconds(100));
+    manager->update();
+    EXPECT_TRUE(manager->hasTemporaryWallAt(pos));
+
+    // 새 벽의 만료 시각(설치 후 200ms)이 지나면 제거
+    clock.advance(std::chrono::milliseconds(100));
+    manager->update();
+    EXPECT_FALSE(manager->hasTemporaryWallAt(pos));
+    EXPECT_EQ(manager->getTemporaryWallCount(), 0);
+}
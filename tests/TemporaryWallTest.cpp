@@ -1,7 +1,7 @@
 #include <gtest/gtest.h>
 #include "TemporaryWall.hpp"
+#include "GameClock.hpp"
 #include <chrono>
-#include <thread>
 
 class TemporaryWallTest : public ::testing::Test {
 protected:
@@ -23,7 +23,7 @@ TEST_F(TemporaryWallTest, TemporaryWallCreationTest) {
     
     EXPECT_EQ(tempWall.getPosition().x, 10);
     EXPECT_EQ(tempWall.getPosition().y, 15);
-    EXPECT_FALSE(tempWall.isExpired());
+    EXPECT_FALSE(tempWall.isExpired(GameClock::time_point()));
 }
 
 // TemporaryWall 만료 테스트
@@ -32,13 +32,14 @@ TEST_F(TemporaryWallTest, TemporaryWallExpirationTest) {
     auto lifetime = std::chrono::milliseconds(100);  // 100ms
     
     TemporaryWall tempWall(pos, lifetime);
+    GameClock clock;
     
     // 새로 생성된 벽은 만료되지 않아야 함
-    EXPECT_FALSE(tempWall.isExpired());
+    EXPECT_FALSE(tempWall.isExpired(clock.now()));
     
-    // 150ms 대기 후 만료되어야 함
-    std::this_thread::sleep_for(std::chrono::milliseconds(150));
-    EXPECT_TRUE(tempWall.isExpired());
+    // 150ms 경과 후 만료되어야 함
+    clock.advance(std::chrono::milliseconds(150));
+    EXPECT_TRUE(tempWall.isExpired(clock.now()));
 }
 
 // TemporaryWall 위치 테스트
@@ -58,17 +59,21 @@ TEST_F(TemporaryWallTest, TemporaryWallPositionTest) {
 
 // TemporaryWall 생성 시간 테스트
 TEST_F(TemporaryWallTest, TemporaryWallCreationTimeTest) {
-    auto beforeCreation = std::chrono::steady_clock::now();
+    GameClock clock;
+    clock.advance(std::chrono::milliseconds(400));
     
     Position pos(10, 10);
     auto lifetime = std::chrono::milliseconds(1000);
-    TemporaryWall tempWall(pos, lifetime);
+    TemporaryWall tempWall(pos, lifetime, clock.now());
     
-    auto afterCreation = std::chrono::steady_clock::now();
-    auto creationTime = tempWall.getCreationTime();
+    // 생성 시간은 게임 시계 기준으로 기록됨
+    EXPECT_EQ(tempWall.getCreationTime(), clock.now());
     
-    EXPECT_GE(creationTime, beforeCreation);
-    EXPECT_LE(creationTime, afterCreation);
+    // 생존 시간은 생성 시점부터 계산됨
+    clock.advance(std::chrono::milliseconds(999));
+    EXPECT_FALSE(tempWall.isExpired(clock.now()));
+    clock.advance(std::chrono::milliseconds(1));
+    EXPECT_TRUE(tempWall.isExpired(clock.now()));
 }
 
 // TemporaryWall 다양한 생존 시간 테스트
@@ -83,14 +88,16 @@ TEST_F(TemporaryWallTest, TemporaryWallVariousLifetimeTest) {
     auto longLifetime = std::chrono::milliseconds(10000);
     TemporaryWall longWall(pos, longLifetime);
     
+    GameClock clock;
+    
     // 초기에는 둘 다 만료되지 않음
-    EXPECT_FALSE(shortWall.isExpired());
-    EXPECT_FALSE(longWall.isExpired());
+    EXPECT_FALSE(shortWall.isExpired(clock.now()));
+    EXPECT_FALSE(longWall.isExpired(clock.now()));
     
-    // 100ms 대기 후
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // 100ms 경과 후
+    clock.advance(std::chrono::milliseconds(100));
     
     // 짧은 벽은 만료, 긴 벽은 아직 유효
-    EXPECT_TRUE(shortWall.isExpired());
-    EXPECT_FALSE(longWall.isExpired());
+    EXPECT_TRUE(shortWall.isExpired(clock.now()));
+    EXPECT_FALSE(longWall.isExpired(clock.now()));
 } 
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#ifndef SNAKE_ENABLE_PROFILING
+#define SNAKE_ENABLE_PROFILING
+#endif
+#include "TickProfiler.hpp"
+#include <sstream>
+#include <string>
+#include <thread>
+
+class TickProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TickProfiler::current().reset();
+    }
+
+    void TearDown() override {
+        TickProfiler::current().reset();
+    }
+};
+
+// 구간별 기록 테스트
+TEST_F(TickProfilerTest, RecordTest) {
+    TickProfiler& profiler = TickProfiler::current();
+    profiler.record(ProfilePhase::SNAKE_MOVE, 1000);
+    profiler.record(ProfilePhase::SNAKE_MOVE, 2000);
+    profiler.record(ProfilePhase::DRAW, 50000);
+
+    EXPECT_EQ(profiler.getHistogram(ProfilePhase::SNAKE_MOVE).getCount(), 2u);
+    EXPECT_EQ(profiler.getHistogram(ProfilePhase::DRAW).getCount(), 1u);
+    EXPECT_EQ(profiler.getHistogram(ProfilePhase::ITEMS).getCount(), 0u);
+}
+
+// 스코프 타이머 매크로 테스트
+TEST_F(TickProfilerTest, ScopedMacroTest) {
+    for (int i = 0; i < 3; i++) {
+        SNAKE_PROFILE_PHASE(UPDATE_MAP);
+        SNAKE_PROFILE_PHASE(GATES);
+    }
+
+    EXPECT_EQ(TickProfiler::current().getHistogram(ProfilePhase::UPDATE_MAP).getCount(), 3u);
+    EXPECT_EQ(TickProfiler::current().getHistogram(ProfilePhase::GATES).getCount(), 3u);
+}
+
+// 스레드마다 독립된 프로파일러인지 테스트
+TEST_F(TickProfilerTest, ThreadLocalTest) {
+    TickProfiler::current().record(ProfilePhase::ITEMS, 10);
+
+    TickProfiler workerResult;
+    std::thread worker([&workerResult]() {
+        TickProfiler::current().record(ProfilePhase::ITEMS, 20);
+        TickProfiler::current().record(ProfilePhase::ITEMS, 30);
+        workerResult.merge(TickProfiler::current());
+    });
+    worker.join();
+
+    EXPECT_EQ(TickProfiler::current().getHistogram(ProfilePhase::ITEMS).getCount(), 1u);
+    EXPECT_EQ(workerResult.getHistogram(ProfilePhase::ITEMS).getCount(), 2u);
+}
+
+// 요약 출력 테스트
+TEST_F(TickProfilerTest, ReportTest) {
+    TickProfiler::current().record(ProfilePhase::COLLISION, 1500);
+
+    std::ostringstream out;
+    TickProfiler::current().writeReport(out);
+    std::string report = out.str();
+
+    EXPECT_NE(report.find("p50"), std::string::npos);
+    EXPECT_NE(report.find("p999"), std::string::npos);
+    for (int i = 0; i < TickProfiler::PHASE_COUNT; i++) {
+        EXPECT_NE(report.find(TickProfiler::getPhaseName(static_cast<ProfilePhase>(i))), std::string::npos);
+    }
+}
@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+#include "VecSnakeEnv.hpp"
+#include "AutopilotPolicy.hpp"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+class VecSnakeEnvTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        env = new VecSnakeEnv(8, 31, 31, 7);
+    }
+
+    void TearDown() override {
+        delete env;
+    }
+
+    VecSnakeEnv* env;
+};
+
+// 초기화 테스트
+TEST_F(VecSnakeEnvTest, InitializationTest) {
+    EXPECT_EQ(env->getEnvCount(), 8);
+    EXPECT_EQ(env->getObservationSize(), 31 * 31);
+    for (int i = 0; i < env->getEnvCount(); i++) {
+        EXPECT_EQ(env->getDones()[i], 0);
+        EXPECT_FLOAT_EQ(env->getRewards()[i], 0.0f);
+        EXPECT_EQ(env->getEpisodeCount(i), 0);
+    }
+}
+
+// 관측이 각 환경의 맵과 같은지 테스트
+TEST_F(VecSnakeEnvTest, ObservationMatchesMapTest) {
+    std::vector<GameAction> actions(8, GameAction::NONE);
+    env->step(actions);
+
+    for (int i = 0; i < env->getEnvCount(); i++) {
+        const GameMap& map = env->getSimulation(i).getMap();
+        const uint8_t* observation = env->getObservation(i);
+        for (int y = 0; y < 31; y++) {
+            for (int x = 0; x < 31; x++) {
+                ASSERT_EQ(observation[y * 31 + x], map.getCellValue(x, y));
+            }
+        }
+    }
+}
+
+// 같은 시드의 단독 Simulation과 진행이 같은지 테스트
+TEST_F(VecSnakeEnvTest, MatchesStandaloneSimulationTest) {
+    Simulation reference(31, 31, VecSnakeEnv::episodeSeed(7, 3, 0));
+    std::vector<GameAction> actions(8, GameAction::NONE);
+    const GameAction turns[] = {
+        GameAction::TURN_UP, GameAction::TURN_LEFT, GameAction::TURN_DOWN, GameAction::TURN_RIGHT
+    };
+
+    for (int tick = 0; tick < 60 && !reference.isGameOver(); tick++) {
+        GameAction action = (tick % 4 == 0) ? turns[(tick / 4) % 4] : GameAction::NONE;
+        actions[3] = action;
+        reference.applyAction(action);
+        reference.update();
+        env->step(actions);
+
+        if (reference.isGameOver()) break;
+        const uint8_t* observation = env->getObservation(3);
+        for (int y = 0; y < 31; y++) {
+            for (int x = 0; x < 31; x++) {
+                ASSERT_EQ(observation[y * 31 + x], reference.getMap().getCellValue(x, y)) << "tick " << tick;
+            }
+        }
+    }
+}
+
+// 여러 에피소드에 걸쳐 모든 환경이 같은 시드의 단독 Simulation과 같은지 테스트
+// (배열 경로와 Simulation 경로가 섞여도, 제자리 리셋 후에도 같은 게임)
+TEST_F(VecSnakeEnvTest, MatchesStandaloneAcrossEpisodesTest) {
+    const int envCount = env->getEnvCount();
+    std::vector<std::unique_ptr<Simulation>> references(envCount);
+    std::vector<long long> episodes(envCount, 0);
+    for (int i = 0; i < envCount; i++) {
+        references[i] = std::make_unique<Simulation>(31, 31, VecSnakeEnv::episodeSeed(7, i, 0));
+    }
+
+    const GameAction choices[] = {
+        GameAction::NONE, GameAction::NONE, GameAction::NONE, GameAction::NONE,
+        GameAction::TURN_UP, GameAction::TURN_DOWN, GameAction::TURN_LEFT, GameAction::TURN_RIGHT
+    };
+    std::vector<GameAction> actions(envCount, GameAction::NONE);
+    uint32_t state = 12345;
+    int simulationSteps = 0;
+    int resets = 0;
+    for (int tick = 0; tick < 600; tick++) {
+        for (int i = 0; i < envCount; i++) {
+            state = state * 1664525u + 1013904223u;
+            actions[i] = (state >> 24) == 0 ? GameAction::PLACE_WALL : choices[(state >> 16) % 8];
+            references[i]->applyAction(actions[i]);
+            references[i]->update();
+        }
+        env->step(actions);
+        simulationSteps += env->getSimulationStepCount();
+
+        for (int i = 0; i < envCount; i++) {
+            ASSERT_EQ(env->getDones()[i] != 0, references[i]->isGameOver()) << "tick " << tick << " env " << i;
+            if (references[i]->isGameOver()) {
+                references[i] = std::make_unique<Simulation>(31, 31, VecSnakeEnv::episodeSeed(7, i, ++episodes[i]));
+                resets++;
+            }
+            std::vector<uint8_t> expected(31 * 31);
+            references[i]->getMap().copyCellsTo(expected.data());
+            ASSERT_TRUE(std::equal(expected.begin(), expected.end(), env->getObservation(i)))
+                << "tick " << tick << " env " << i;
+        }
+    }
+    EXPECT_GT(resets, 0);
+    // 대부분의 틱은 배열 경로로 진행
+    EXPECT_LT(simulationSteps, 600 * envCount / 2);
+}
+
+// 종료된 환경이 자동 리셋되는지 테스트
+TEST_F(VecSnakeEnvTest, AutoResetTest) {
+    std::vector<GameAction> actions(8, GameAction::NONE);
+    actions[2] = GameAction::QUIT;
+    env->step(actions);
+
+    EXPECT_EQ(env->getDones()[2], 1);
+    EXPECT_EQ(env->getEpisodeCount(2), 1);
+    EXPECT_FLOAT_EQ(env->getRewards()[2], VecSnakeEnv::REWARD_DEATH);
+    EXPECT_FLOAT_EQ(env->getLastEpisodeReturn(2), VecSnakeEnv::REWARD_DEATH);
+
+    // 새 에피소드로 교체됨
+    EXPECT_FALSE(env->getSimulation(2).isGameOver());
+    EXPECT_EQ(env->getSimulation(2).getClock().getTickCount(), 0);
+    EXPECT_EQ(env->getSimulation(2).getSeed(), VecSnakeEnv::episodeSeed(7, 2, 1));
+
+    // 다른 환경은 영향 없음
+    EXPECT_EQ(env->getDones()[1], 0);
+    EXPECT_EQ(env->getSimulation(1).getClock().getTickCount(), 1);
+}
+
+// 벽으로 돌진하면 죽음 보상과 함께 끝나는지 테스트
+TEST_F(VecSnakeEnvTest, DeathRewardTest) {
+    std::vector<GameAction> actions(8, GameAction::TURN_UP);
+    float total = 0.0f;
+    bool ended = false;
+    for (int tick = 0; tick < 20 && !ended; tick++) {
+        env->step(actions);
+        total += env->getRewards()[0];
+        ended = env->getDones()[0] != 0;
+    }
+    EXPECT_TRUE(ended);
+    EXPECT_LE(total, VecSnakeEnv::REWARD_DEATH + 5.0f);
+}
+
+// 스테이지 클리어 보상에 스테이지 전환의 길이 초기화가 벌점으로 섞이지 않는지 테스트
+TEST_F(VecSnakeEnvTest, StageClearRewardIgnoresLengthResetTest) {
+    VecSnakeEnv single(1, 31, 31, 7);
+    AutopilotPolicy autopilot;
+    std::vector<GameAction> actions(1, GameAction::NONE);
+    int clears = 0;
+
+    for (int tick = 0; tick < 5000 && clears < 2; tick++) {
+        const Simulation& before = single.getSimulation(0);
+        int lengthBefore = before.getSnake().getLength();
+        int stageBefore = before.getStageManager().getCurrentStageNumber();
+        int growthBefore = before.getScoreManager().getTotalGrowthItemsCollected();
+        int gatesBefore = before.getScoreManager().getTotalGatesUsed();
+        actions[0] = autopilot.chooseAction(before);
+        single.step(actions);
+        if (single.getDones()[0]) {
+            continue;
+        }
+
+        const Simulation& after = single.getSimulation(0);
+        if (after.getStageManager().getCurrentStageNumber() <= stageBefore ||
+            lengthBefore <= after.getSnake().getLength()) {
+            continue;
+        }
+        // 길이가 줄었지만 (초기 길이로 리셋) 보상은 클리어 + 마지막 Growth/Gate만큼
+        int growth = after.getScoreManager().getTotalGrowthItemsCollected() - growthBefore;
+        int gates = after.getScoreManager().getTotalGatesUsed() - gatesBefore;
+        EXPECT_FLOAT_EQ(single.getRewards()[0], VecSnakeEnv::REWARD_STAGE_CLEAR +
+                                                growth * VecSnakeEnv::REWARD_PER_LENGTH +
+                                                gates * VecSnakeEnv::REWARD_PER_GATE)
+            << "tick " << tick << " length " << lengthBefore << " stage " << stageBefore;
+        EXPECT_GE(single.getRewards()[0], VecSnakeEnv::REWARD_STAGE_CLEAR);
+        clears++;
+    }
+    EXPECT_EQ(clears, 2);
+}
+
+// 병렬 실행 결과가 순차 실행과 같은지 테스트
+TEST_F(VecSnakeEnvTest, ThreadedStepMatchesSerialTest) {
+    VecSnakeEnv threaded(8, 31, 31, 7, 4);
+    std::vector<GameAction> actions(8, GameAction::NONE);
+    for (int tick = 0; tick < 30; tick++) {
+        for (int i = 0; i < 8; i++) {
+            actions[i] = (tick + i) % 5 == 0 ? GameAction::TURN_DOWN : GameAction::TURN_RIGHT;
+        }
+        env->step(actions);
+        threaded.step(actions);
+        for (int i = 0; i < 8; i++) {
+            ASSERT_EQ(env->getDones()[i], threaded.getDones()[i]);
+            ASSERT_FLOAT_EQ(env->getRewards()[i], threaded.getRewards()[i]);
+        }
+    }
+    for (int i = 0; i < 8 * 31 * 31; i++) {
+        ASSERT_EQ(env->getObservations()[i], threaded.getObservations()[i]);
+    }
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "WorkStealingPool.hpp"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+class WorkStealingPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pool = new WorkStealingPool(4);
+    }
+
+    void TearDown() override {
+        delete pool;
+    }
+
+    WorkStealingPool* pool;
+};
+
+// 스레드 수 테스트
+TEST_F(WorkStealingPoolTest, ThreadCountTest) {
+    EXPECT_EQ(pool->getThreadCount(), 4);
+
+    WorkStealingPool defaultPool;
+    EXPECT_GE(defaultPool.getThreadCount(), 1);
+}
+
+// 모든 인덱스가 정확히 한 번씩 실행되는지 테스트
+TEST_F(WorkStealingPoolTest, EveryIndexRunsOnceTest) {
+    const size_t count = 1000;
+    std::vector<std::atomic<int>> runs(count);
+    for (auto& run : runs) {
+        run = 0;
+    }
+
+    pool->parallelFor(count, [&runs](size_t index, int worker) {
+        EXPECT_GE(worker, 0);
+        EXPECT_LT(worker, 4);
+        runs[index]++;
+    });
+
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_EQ(runs[i].load(), 1) << "index " << i;
+    }
+}
+
+// 여러 번 연속 실행 테스트
+TEST_F(WorkStealingPoolTest, RepeatedJobsTest) {
+    for (int job = 0; job < 50; job++) {
+        std::atomic<int> total(0);
+        pool->parallelFor(static_cast<size_t>(job), [&total](size_t, int) { total++; });
+        EXPECT_EQ(total.load(), job);
+    }
+}
+
+// 한 구간에 오래 걸리는 작업이 몰리면 다른 워커가 훔쳐 가는지 테스트
+TEST_F(WorkStealingPoolTest, StealingBalancesLoadTest) {
+    std::vector<std::atomic<int>> perWorker(4);
+    for (auto& count : perWorker) {
+        count = 0;
+    }
+
+    // 워커 0의 구간(앞쪽 1/4)만 느린 작업
+    pool->parallelFor(64, [&perWorker](size_t index, int worker) {
+        if (index < 16) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        perWorker[worker]++;
+    });
+
+    EXPECT_GT(pool->getStealCount(), 0);
+    EXPECT_LT(perWorker[0].load(), 16);
+}
+
+// 작업 예외가 호출자에게 전달되는지 테스트
+TEST_F(WorkStealingPoolTest, ExceptionPropagationTest) {
+    EXPECT_THROW(pool->parallelFor(10, [](size_t index, int) {
+        if (index == 7) {
+            throw std::runtime_error("task failed");
+        }
+    }), std::runtime_error);
+
+    // 예외 이후에도 계속 사용 가능
+    std::atomic<int> total(0);
+    pool->parallelFor(10, [&total](size_t, int) { total++; });
+    EXPECT_EQ(total.load(), 10);
+}